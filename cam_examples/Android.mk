@@ -1,11 +1,18 @@
 LOCAL_PATH:= $(call my-dir)
 include $(CLEAR_VARS)
 
-LOCAL_SRC_FILES := CameraCapture.cpp
+LOCAL_SRC_FILES := CameraCapture.cpp \
+	frame_archive.cpp \
+	dmabuf_share.cpp \
+	frame_pool.cpp \
+	stack_demux.cpp \
+	mjpeg_preview.cpp
 
 LOCAL_MODULE := CameraCapture
+LOCAL_CPPFLAGS := -std=c++11 -DHAVE_LIBJPEG
+LOCAL_C_INCLUDES := external/libjpeg-turbo
 
-LOCAL_STATIC_LIBRARIES := libc
+LOCAL_STATIC_LIBRARIES := libjpeg libc
 LOCAL_MODULE_PATH:= $(TARGET_ROOT_OUT_SBIN)/pretest
 LOCAL_FORCE_STATIC_EXECUTABLE := true
 
@@ -14,3 +21,58 @@ LOCAL_SHARED_LIBRARIES:= \
 	libcutils
 
 include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := DmabufConsumer.cpp \
+	dmabuf_share.cpp
+
+LOCAL_MODULE := DmabufConsumer
+LOCAL_CPPFLAGS := -std=c++11
+
+LOCAL_STATIC_LIBRARIES := libc
+LOCAL_MODULE_PATH:= $(TARGET_ROOT_OUT_SBIN)/pretest
+LOCAL_FORCE_STATIC_EXECUTABLE := true
+
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := MultiCapture.cpp
+
+LOCAL_MODULE := MultiCapture
+LOCAL_CPPFLAGS := -std=c++11
+
+LOCAL_STATIC_LIBRARIES := libc
+LOCAL_MODULE_PATH:= $(TARGET_ROOT_OUT_SBIN)/pretest
+LOCAL_FORCE_STATIC_EXECUTABLE := true
+
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := YuvConvert.cpp \
+	yuv_convert.cpp \
+	png_write.cpp
+
+LOCAL_MODULE := YuvConvert
+LOCAL_CPPFLAGS := -std=c++11
+
+LOCAL_STATIC_LIBRARIES := libc
+LOCAL_MODULE_PATH:= $(TARGET_ROOT_OUT_SBIN)/pretest
+LOCAL_FORCE_STATIC_EXECUTABLE := true
+
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := BatchConvert.cpp \
+	yuv_convert.cpp \
+	png_write.cpp \
+	frame_archive.cpp
+
+LOCAL_MODULE := BatchConvert
+LOCAL_CPPFLAGS := -std=c++11
+LOCAL_LDLIBS := -lpthread
+
+include $(BUILD_HOST_EXECUTABLE)
@@ -0,0 +1,448 @@
+#define LOG_TAG "BatchConvert"
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef HAVE_LIBJPEG
+extern "C" {
+#include <jpeglib.h>
+}
+#endif
+
+#include "yuv_convert.h"
+#include "png_write.h"
+#include "frame_archive.h"
+
+using namespace std;
+
+/*
+ * Host side: turn a whole recording (a raw .data file of back to back
+ * frames, or a frame archive from CameraCapture -o) into an image per
+ * frame. Frames are spread over all cores on a work-stealing pool and the
+ * input is only ever mapped, never read into memory.
+ */
+
+struct recording {
+    int                             fd;
+    const uint8_t *                 base;
+    size_t                          size;
+    struct frame_archive_reader *   archive;
+    unsigned int                    width;
+    unsigned int                    height;
+    size_t                          frame_bytes;
+    unsigned long                   count;
+};
+
+struct job_options {
+    enum yuv_packed     in;
+    unsigned int        scale;
+    bool                jpeg;
+    int                 quality;
+    const char *        out_dir;
+    const char *        prefix;
+};
+
+/* each worker owns a deque: pops its own front, steals from others' back */
+struct work_queue {
+    mutex               lock;
+    deque<unsigned long> frames;
+};
+
+struct worker_stats {
+    unsigned long       frames;
+    unsigned long       steals;
+    unsigned long       failed;
+    unsigned long long  busy_ns;
+};
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int open_recording(const char *path, unsigned int width, unsigned int height,
+        struct recording *rec)
+{
+    struct archive_entry e;
+    struct stat st;
+    char magic[8];
+
+    memset(rec, 0, sizeof(*rec));
+    rec->fd = -1;
+
+    rec->fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (rec->fd < 0 || fstat(rec->fd, &st)) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+        return -1;
+    }
+
+    if (pread(rec->fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+            !memcmp(magic, ARCHIVE_MAGIC, sizeof(magic))) {
+        rec->archive = archive_open(path);
+        if (!rec->archive)
+            return -1;
+        rec->count = archive_frame_count(rec->archive);
+        if (rec->count && archive_frame(rec->archive, 0, &e)) {
+            rec->width = e.width;
+            rec->height = e.height;
+        }
+        return 0;
+    }
+
+    rec->width = width;
+    rec->height = height;
+    rec->frame_bytes = (size_t)width * height * 2;
+    rec->size = st.st_size;
+    rec->count = rec->size / rec->frame_bytes;
+    if (!rec->count) {
+        printf("[%s]%d, %s is smaller than one %ux%u frame\n", __func__, __LINE__, path, width, height);
+        return -1;
+    }
+    rec->base = (const uint8_t *)mmap(NULL, rec->size, PROT_READ, MAP_SHARED, rec->fd, 0);
+    if (rec->base == MAP_FAILED) {
+        printf("[%s]%d, mmap failed: %s\n", __func__, __LINE__, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+static void close_recording(struct recording *rec)
+{
+    if (rec->archive)
+        archive_release(rec->archive);
+    if (rec->base && rec->base != MAP_FAILED)
+        munmap((void *)rec->base, rec->size);
+    if (rec->fd >= 0)
+        close(rec->fd);
+}
+
+static const uint8_t *frame_data(const struct recording *rec, unsigned long i,
+        unsigned int *width, unsigned int *height)
+{
+    struct archive_entry e;
+    const void *p;
+
+    if (rec->archive) {
+        p = archive_frame(rec->archive, i, &e);
+        *width = e.width;
+        *height = e.height;
+        return (const uint8_t *)p;
+    }
+    *width = rec->width;
+    *height = rec->height;
+    return rec->base + i * rec->frame_bytes;
+}
+
+/* frames are visited once: let the kernel drop the pages behind us */
+static void release_frame(const struct recording *rec, unsigned long i)
+{
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t start, end;
+
+    if (rec->archive)
+        return;
+    start = ((uintptr_t)rec->base + i * rec->frame_bytes + page - 1) & ~(page - 1);
+    end = ((uintptr_t)rec->base + (i + 1) * rec->frame_bytes) & ~(page - 1);
+    if (end > start)
+        madvise((void *)start, end - start, MADV_DONTNEED);
+}
+
+/* box filter, scale x scale RGB pixels to one */
+static void downscale(const uint8_t *src, unsigned int w, unsigned int h,
+        unsigned int scale, uint8_t *dst)
+{
+    unsigned int ow = w / scale, oh = h / scale, n = scale * scale;
+    unsigned int x, y, dx, dy, c, sum;
+
+    for (y = 0; y < oh; y++) {
+        for (x = 0; x < ow; x++) {
+            for (c = 0; c < 3; c++) {
+                sum = 0;
+                for (dy = 0; dy < scale; dy++)
+                    for (dx = 0; dx < scale; dx++)
+                        sum += src[((size_t)(y * scale + dy) * w + x * scale + dx) * 3 + c];
+                dst[((size_t)y * ow + x) * 3 + c] = (sum + n / 2) / n;
+            }
+        }
+    }
+}
+
+#ifdef HAVE_LIBJPEG
+static int write_jpeg(const char *path, const uint8_t *rgb, unsigned int w, unsigned int h,
+        int quality)
+{
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    JSAMPROW row;
+    FILE *f;
+
+    f = fopen(path, "wb");
+    if (!f) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+        return -1;
+    }
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_stdio_dest(&cinfo, f);
+    cinfo.image_width = w;
+    cinfo.image_height = h;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        row = (JSAMPROW)(rgb + (size_t)cinfo.next_scanline * w * 3);
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    return fclose(f) ? -1 : 0;
+}
+#endif
+
+static int convert_frame(const struct recording *rec, unsigned long i,
+        const struct job_options *opt, vector<uint8_t> &rgb, vector<uint8_t> &small)
+{
+    unsigned int w, h, ow, oh;
+    const uint8_t *src;
+    const uint8_t *img;
+    char path[512];
+    int ret;
+
+    src = frame_data(rec, i, &w, &h);
+    if (!src)
+        return -1;
+
+    rgb.resize(yuv_output_size(YUV_OUT_RGB24, w, h));
+    ret = yuv_convert(src, w * 2, opt->in, rgb.data(), YUV_OUT_RGB24, w, h, YUV_ISA_AUTO);
+    release_frame(rec, i);
+    if (ret)
+        return ret;
+
+    img = rgb.data();
+    ow = w;
+    oh = h;
+    if (opt->scale > 1) {
+        ow = w / opt->scale;
+        oh = h / opt->scale;
+        small.resize((size_t)ow * oh * 3);
+        downscale(rgb.data(), w, h, opt->scale, small.data());
+        img = small.data();
+    }
+
+    snprintf(path, sizeof(path), "%s/%s_%06lu.%s", opt->out_dir, opt->prefix, i,
+            opt->jpeg ? "jpg" : "png");
+#ifdef HAVE_LIBJPEG
+    if (opt->jpeg)
+        return write_jpeg(path, img, ow, oh, opt->quality);
+#endif
+    return png_write_rgb(path, img, ow, oh);
+}
+
+static bool next_frame(vector<work_queue> &queues, unsigned int self,
+        unsigned long *frame, bool *stolen)
+{
+    unsigned int i, victim;
+
+    {
+        lock_guard<mutex> l(queues[self].lock);
+
+        if (!queues[self].frames.empty()) {
+            *frame = queues[self].frames.front();
+            queues[self].frames.pop_front();
+            *stolen = false;
+            return true;
+        }
+    }
+    for (i = 1; i < queues.size(); i++) {
+        victim = (self + i) % queues.size();
+        lock_guard<mutex> l(queues[victim].lock);
+
+        if (!queues[victim].frames.empty()) {
+            *frame = queues[victim].frames.back();
+            queues[victim].frames.pop_back();
+            *stolen = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void worker_main(const struct recording *rec, const struct job_options *opt,
+        vector<work_queue> *queues, unsigned int self, struct worker_stats *st)
+{
+    vector<uint8_t> rgb, small;
+    unsigned long long t;
+    unsigned long frame;
+    bool stolen;
+
+    while (next_frame(*queues, self, &frame, &stolen)) {
+        t = now_ns();
+        if (convert_frame(rec, frame, opt, rgb, small))
+            st->failed++;
+        else
+            st->frames++;
+        st->busy_ns += now_ns() - t;
+        if (stolen)
+            st->steals++;
+    }
+}
+
+static void usage(const char *prog)
+{
+    cout << "usage: " << prog << " [-W width] [-H height] [-f yuyv|uyvy] [-r first:last] [-e n] [-s n] [-j threads] [-o png|jpg] [-q quality] <recording> <out_dir>" << endl;
+    cout << "  -W/-H  frame size of a raw .data recording (default 1280x800; archives carry their own)" << endl;
+    cout << "  -r     only frames first..last (inclusive, either side may be empty)" << endl;
+    cout << "  -e     every n-th frame of that range" << endl;
+    cout << "  -s     shrink by an integer factor" << endl;
+    cout << "  -j     worker threads (default: all online cores)" << endl;
+#ifdef HAVE_LIBJPEG
+    cout << "  -o     png (default) or jpg, -q sets the JPEG quality (default 90)" << endl;
+#else
+    cout << "  -o     png only: built without libjpeg (-DHAVE_LIBJPEG -ljpeg)" << endl;
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    struct recording rec;
+    struct job_options opt;
+    vector<work_queue> *queues;
+    vector<worker_stats> stats;
+    vector<thread> workers;
+    unsigned int width = 1280, height = 800;
+    unsigned int threads = thread::hardware_concurrency();
+    unsigned long first = 0, last = ~0UL, stride = 1, i, k, n, total = 0, failed = 0;
+    unsigned long long start, elapsed;
+    const char *base;
+    char prefix[256];
+    char *dot;
+    int c;
+
+    opt.in = YUV_YUYV;
+    opt.scale = 1;
+    opt.jpeg = false;
+    opt.quality = 90;
+
+    while ((c = getopt(argc, argv, "W:H:f:r:e:s:j:o:q:")) != -1) {
+        switch (c) {
+        case 'W':
+            width = strtoul(optarg, NULL, 0);
+            break;
+        case 'H':
+            height = strtoul(optarg, NULL, 0);
+            break;
+        case 'f':
+            opt.in = strcmp(optarg, "uyvy") ? YUV_YUYV : YUV_UYVY;
+            break;
+        case 'r':
+            if (*optarg != ':')
+                first = strtoul(optarg, &optarg, 0);
+            if (*optarg == ':' && optarg[1])
+                last = strtoul(optarg + 1, NULL, 0);
+            break;
+        case 'e':
+            stride = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            opt.scale = strtoul(optarg, NULL, 0);
+            break;
+        case 'j':
+            threads = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            opt.jpeg = !strcmp(optarg, "jpg") || !strcmp(optarg, "jpeg");
+            break;
+        case 'q':
+            opt.quality = strtol(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (argc - optind != 2 || !stride || !opt.scale) {
+        cout << "invalid param!" << endl;
+        usage(argv[0]);
+        return -1;
+    }
+#ifndef HAVE_LIBJPEG
+    if (opt.jpeg) {
+        cout << "built without libjpeg, use -o png" << endl;
+        return -1;
+    }
+#endif
+    if (!threads)
+        threads = 1;
+
+    if (open_recording(argv[optind], width, height, &rec)) {
+        close_recording(&rec);
+        return -1;
+    }
+    opt.out_dir = argv[optind + 1];
+    base = strrchr(argv[optind], '/');
+    snprintf(prefix, sizeof(prefix), "%s", base ? base + 1 : argv[optind]);
+    dot = strrchr(prefix, '.');
+    if (dot)
+        *dot = '\0';
+    opt.prefix = prefix;
+
+    if (last >= rec.count)
+        last = rec.count - 1;
+    printf("%s: %lu frames of %ux%u, converting %lu..%lu every %lu on %u threads (%s)\n",
+            argv[optind], rec.count, rec.width, rec.height, first, last, stride,
+            threads, yuv_isa_name(yuv_best_isa()));
+
+    /* contiguous slices keep each worker streaming through its own part of the file */
+    n = first <= last ? (last - first) / stride + 1 : 0;
+    if (!n) {
+        cout << "no frames in that range" << endl;
+        close_recording(&rec);
+        return -1;
+    }
+    queues = new vector<work_queue>(threads);
+    for (i = first, k = 0; k < n; i += stride, k++)
+        (*queues)[k * threads / n].frames.push_back(i);
+
+    stats.assign(threads, worker_stats());
+    start = now_ns();
+    for (i = 0; i < threads; i++)
+        workers.push_back(thread(worker_main, &rec, &opt, queues, (unsigned int)i, &stats[i]));
+    for (i = 0; i < threads; i++)
+        workers[i].join();
+    elapsed = now_ns() - start;
+
+    for (i = 0; i < threads; i++) {
+        printf("worker %lu: %lu frames, %lu stolen, %.1f fps while busy\n", i, stats[i].frames,
+                stats[i].steals, stats[i].busy_ns ? stats[i].frames * 1e9 / stats[i].busy_ns : 0.0);
+        total += stats[i].frames;
+        failed += stats[i].failed;
+    }
+    printf("%lu frames in %.3f s: %.1f fps, %.1f fps per core", total, elapsed / 1e9,
+            elapsed ? total * 1e9 / elapsed : 0.0,
+            elapsed ? total * 1e9 / elapsed / threads : 0.0);
+    if (failed)
+        printf(", %lu failed", failed);
+    printf("\n");
+
+    delete queues;
+    close_recording(&rec);
+    return failed ? -1 : 0;
+}
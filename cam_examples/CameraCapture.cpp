@@ -1,94 +1,754 @@
-
-
 #define LOG_TAG "CameraCapture"
 #define LOG_NDEBUG 0
 
 #include <iostream>
 #include <fstream>
+#include <thread>
+#include <atomic>
 #include <linux/videodev2.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
 #include <malloc.h>
 #include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
 #include <errno.h>
 
+#include "spsc_ring.h"
+#include "frame_archive.h"
+#include "dmabuf_share.h"
+#include "frame_pool.h"
+#include "stack_demux.h"
+#include "mjpeg_preview.h"
+
 using namespace std;
 
 
 #define PIC_CNT 4
+/* give up when the driver delivers nothing for this long */
+#define FRAME_TIMEOUT_MS 2000
+/* buffers always left with the driver while the writer thread is behind */
+#define MIN_QUEUED 2
+/* height of one camera in the max9286 stacked output */
+#define CAMERA_HEIGHT 800
+#define PREVIEW_QUALITY 80
 
 struct buffer {
     void *                  start;
     size_t                  length;
+    int                     dmabuf_fd;
+};
+
+struct stream_stats {
+    unsigned long           frames;
+    unsigned long           dropped;
+    unsigned long           backpressure;
+    unsigned long long      shared_bytes;
+    unsigned long long      hold_ns;
+    unsigned long long      hold_max_ns;
+    unsigned long           stale;
+    unsigned long           bad_returns;
+    unsigned int            last_seq;
+    bool                    have_seq;
+};
+
+enum save_mode {
+    SAVE_NONE,
+    SAVE_INLINE,
+    SAVE_THREAD,
+    SHARE_LOCAL,
+    SHARE_REMOTE,
+    PREVIEW,
+};
+
+struct frame_job {
+    unsigned int            index;
+    unsigned int            bytesused;
+    unsigned int            sequence;
+    unsigned long           n;
+    unsigned long long      timestamp_ns;
+};
+
+/*
+ * The capture thread hands filled buffers to the worker through jobs and
+ * gets them back through done; each direction has its own eventfd so both
+ * sides can sleep. process() is the file writer, the dma-buf consumer or
+ * the preview encoder; with latest_only it only sees the newest queued job
+ * and older ones go straight back unprocessed.
+ */
+struct frame_writer {
+    SpscRing<frame_job> *   jobs;
+    SpscRing<unsigned int> *done;
+    int                     job_efd;
+    int                     done_efd;
+    atomic<bool>            quit;
+    thread                  worker;
+    int                     (*process)(const struct frame_job *job);
+    bool                    latest_only;
+    unsigned long           stale;
 };
 
 unsigned long n_buffers;
 struct buffer *buffers;
 int fd;
+struct v4l2_pix_format pix;
+struct frame_archive *archive;
+/* the in-process consumer's own mappings of the exported buffers */
+struct dmabuf_view *views;
+int share_sock = -1;
+/* USERPTR mode: the application owns the frames, the driver fills them */
+enum v4l2_memory memory = V4L2_MEMORY_MMAP;
+struct frame_pool *pool;
+/* -D: save each camera of a stacked frame on its own */
+bool demux;
+struct stack_layout layout;
+struct stack_splitter *splitter;
+struct frame_pool *split_pool;
+volatile unsigned long long consume_sum;
+/* -p: encoded on the writer thread, served to every preview client */
+struct mjpeg_encoder *encoder;
+struct preview_server *preview;
+unsigned long long encode_ns, encode_max_ns;
+unsigned long encoded;
+
+static volatile sig_atomic_t stop_streaming;
 
-static int read_frame(void) 
+static void on_signal(int sig)
 {
-    struct v4l2_buffer buf;
-    int ret;
-    int i;
+    stop_streaming = 1;
+}
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* link < 0: the whole frame, otherwise one camera of it */
+static int save_image(const struct frame_job *job, const void *data, size_t len,
+        unsigned int height, int link)
+{
+    struct archive_frame_info info;
     char file_name[256];
     int f_id;
-    //int timeout;
+    int ret;
 
-    printf("[%s]%d\n", __func__, __LINE__);
+    if (archive) {
+        info.sequence = job->sequence;
+        info.timestamp_ns = job->timestamp_ns;
+        info.pixelformat = pix.pixelformat;
+        info.width = pix.width;
+        info.height = height;
+        ret = archive_append(archive, data, len, &info);
+        if (ret)
+            printf("[%s]%d, archive append failed: %s\n", __func__, __LINE__, strerror(-ret));
+        return ret;
+    }
 
-    for (i = 0; i < PIC_CNT; i++) {
-        ret = sprintf(file_name, "/sdcard/Movies/mtk_yuyv%d.data",i);
-        if (ret < 0) {
-            cout << __func__<< ":" << dec << __LINE__ << "==>>pic "<< i<< endl;
-            return ret;
+    if (link < 0)
+        snprintf(file_name, sizeof(file_name), "/sdcard/Movies/mtk_yuyv%lu.data", job->n);
+    else
+        snprintf(file_name, sizeof(file_name), "/sdcard/Movies/mtk_yuyv%lu_link%d.data", job->n, link);
+    f_id = open(file_name, O_RDWR | O_CREAT | O_TRUNC, 0777);
+    if (f_id < 0) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, file_name, strerror(errno));
+        return -1;
+    }
+
+    ret = write(f_id, data, len);
+    if (ret < 0)
+        printf("[%s]%d, write %s failed: %s\n", __func__, __LINE__, file_name, strerror(errno));
+
+    close(f_id);
+    return ret < 0 ? ret : 0;
+}
+
+/*
+ * With -D every camera is saved straight from its stripe of the capture
+ * buffer; only padded rows force a split into packed buffers first.
+ */
+static int save_frame(const struct frame_job *job)
+{
+    struct stack_view views[STACK_MAX_CAMERAS];
+    void *dst[STACK_MAX_CAMERAS];
+    int i, n;
+    int ret = 0;
+
+    if (!demux)
+        return save_image(job, buffers[job->index].start, job->bytesused, pix.height, -1);
+
+    n = stack_views(&layout, buffers[job->index].start, pix.bytesperline,
+            pix.width, pix.height, views);
+    if (n < 0)
+        return n;
+
+    if (!stack_view_contiguous(&views[0], 2)) {
+        for (i = 0; i < n; i++)
+            dst[i] = frame_pool_frame(split_pool, i);
+        stack_split(splitter, views, n, 2, dst);
+        for (i = 0; i < n; i++) {
+            views[i].data = (const uint8_t *)dst[i];
+            views[i].stride = views[i].width * 2;
+            views[i].bytes = views[i].stride * views[i].height;
         }
+    }
 
-        file_name[ret] = '\0';
+    for (i = 0; i < n && !ret; i++)
+        ret = save_image(job, views[i].data, views[i].bytes, views[i].height, views[i].link);
+    return ret;
+}
 
-        printf("file_name = %s\n", file_name);
+/*
+ * Stand-in for an encoder or preview: read the whole frame through the
+ * dma-buf mapping, one load per cache line, without copying it anywhere.
+ */
+static int consume_frame(const struct frame_job *job)
+{
+    const struct dmabuf_view *v = &views[job->index];
+    const unsigned long long *p = (const unsigned long long *)v->addr;
+    size_t i, n = job->bytesused / sizeof(*p);
+    unsigned long long sum = 0;
 
-        f_id = open(file_name, O_RDWR | O_CREAT, 0777);
+    dmabuf_begin_read(v);
+    for (i = 0; i < n; i += 64 / sizeof(*p))
+        sum += p[i];
+    dmabuf_end_read(v);
 
-        if (f_id < 0) {
-            //printf("---------: %s, \n", strerror(errno));
+    consume_sum += sum;
+    return 0;
+}
+
+static int share_frame(const struct frame_job *job)
+{
+    struct dmabuf_frame_msg msg;
+    int ret;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.index = job->index;
+    msg.bytesused = job->bytesused;
+    msg.sequence = job->sequence;
+    msg.timestamp_ns = job->timestamp_ns;
+    ret = dmabuf_send_fds(share_sock, &msg, sizeof(msg), NULL, 0);
+    if (ret)
+        printf("[%s]%d, send failed: %s\n", __func__, __LINE__, strerror(-ret));
+    return ret;
+}
+
+static int preview_frame(const struct frame_job *job)
+{
+    const uint8_t *jpeg;
+    unsigned long long t;
+    size_t len;
+    int ret;
+
+    t = now_ns();
+    ret = mjpeg_encode(encoder, buffers[job->index].start, pix.bytesperline, &jpeg, &len);
+    if (ret) {
+        printf("[%s]%d, encode failed: %s\n", __func__, __LINE__, strerror(-ret));
+        return ret;
+    }
+    t = now_ns() - t;
+    encode_ns += t;
+    if (t > encode_max_ns)
+        encode_max_ns = t;
+    encoded++;
+
+    preview_publish(preview, jpeg, len, job->timestamp_ns);
+    return 0;
+}
+
+static void writer_main(struct frame_writer *w)
+{
+    struct frame_job job, newer;
+    eventfd_t cnt;
+    bool quit;
+
+    for (;;) {
+        /* sample quit first so nothing pushed before it is left behind */
+        quit = w->quit.load();
+        while (w->jobs->pop(job)) {
+            if (w->latest_only && w->jobs->pop(newer)) {
+                do {
+                    w->done->push(job.index);
+                    w->stale++;
+                    job = newer;
+                } while (w->jobs->pop(newer));
+                eventfd_write(w->done_efd, 1);
+            }
+            w->process(&job);
+            w->done->push(job.index);
+            eventfd_write(w->done_efd, 1);
         }
+        if (quit)
+            break;
+        eventfd_read(w->job_efd, &cnt);
+    }
+}
 
-        printf("[%s]%d, ---------f_id = %d------------\n", __func__, __LINE__, f_id);
-		
-        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-        buf.memory = V4L2_MEMORY_MMAP;
-        buf.index = i;
-        printf("[%s]%d, ---------VIDIOC_DQBUF------------\n", __func__, __LINE__);
-        ret = ioctl(fd, VIDIOC_DQBUF, &buf); 
-        if (ret) {
-            printf("[%s]%d, failed:%d\n", __func__, __LINE__, i);
-            return ret;
+static int writer_start(struct frame_writer *w, int (*process)(const struct frame_job *),
+        bool latest_only)
+{
+    w->jobs = new SpscRing<frame_job>(n_buffers);
+    w->done = new SpscRing<unsigned int>(n_buffers);
+    w->job_efd = eventfd(0, EFD_CLOEXEC);
+    w->done_efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (w->job_efd < 0 || w->done_efd < 0) {
+        printf("[%s]%d, eventfd failed: %s\n", __func__, __LINE__, strerror(errno));
+        return -1;
+    }
+    w->quit = false;
+    w->process = process;
+    w->latest_only = latest_only;
+    w->stale = 0;
+    w->worker = thread(writer_main, w);
+    return 0;
+}
+
+static void writer_stop(struct frame_writer *w, struct stream_stats *st)
+{
+    if (w->worker.joinable()) {
+        w->quit = true;
+        eventfd_write(w->job_efd, 1);
+        w->worker.join();
+        st->stale = w->stale;
+    }
+    if (w->job_efd >= 0)
+        close(w->job_efd);
+    if (w->done_efd >= 0)
+        close(w->done_efd);
+    delete w->jobs;
+    delete w->done;
+}
+
+static void account_frame(struct stream_stats *st, struct v4l2_buffer *buf)
+{
+    /* the driver bumps sequence for every frame, even ones it had no buffer for */
+    if (st->have_seq && buf->sequence > st->last_seq + 1)
+        st->dropped += buf->sequence - st->last_seq - 1;
+    st->last_seq = buf->sequence;
+    st->have_seq = true;
+    st->frames++;
+}
+
+static int queue_buffer(unsigned int index)
+{
+    struct v4l2_buffer buf;
+
+    memset(&buf, 0, sizeof(buf));
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = memory;
+    buf.index = index;
+    if (memory == V4L2_MEMORY_USERPTR) {
+        buf.m.userptr = (unsigned long)buffers[index].start;
+        buf.length = buffers[index].length;
+    }
+    if (ioctl(fd, VIDIOC_QBUF, &buf)) {
+        printf("[%s]%d, VIDIOC_QBUF failed: %s\n", __func__, __LINE__, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+static int requeue(unsigned int index, struct stream_stats *st,
+        unsigned long long *dq_time)
+{
+    unsigned long long hold;
+
+    if (queue_buffer(index))
+        return -1;
+
+    hold = now_ns() - dq_time[index];
+    st->hold_ns += hold;
+    if (hold > st->hold_max_ns)
+        st->hold_max_ns = hold;
+    return 0;
+}
+
+/*
+ * Buffers the remote consumer has finished with come back as frame
+ * messages; returns -1 once it hangs up. Only buffers that are actually
+ * lent out are taken back: a duplicate or stale return would otherwise
+ * queue a buffer the driver already owns and fail QBUF with EINVAL.
+ */
+static int reclaim_remote(struct stream_stats *st, unsigned long long *dq_time,
+        bool *lent, unsigned int *held)
+{
+    struct dmabuf_frame_msg msg;
+    ssize_t n;
+
+    for (;;) {
+        n = recv(share_sock, &msg, sizeof(msg), MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EINTR)
+                return 0;
+            printf("[%s]%d, recv failed: %s\n", __func__, __LINE__, strerror(errno));
+            return -1;
+        }
+        if (n == 0) {
+            printf("[%s]%d, consumer went away\n", __func__, __LINE__);
+            return -1;
+        }
+        if (n != sizeof(msg) || msg.index >= n_buffers)
+            continue;
+        if (!lent[msg.index]) {
+            printf("[%s]%d, buffer %u returned but not lent out, ignored\n",
+                    __func__, __LINE__, msg.index);
+            st->bad_returns++;
+            continue;
+        }
+        lent[msg.index] = false;
+        (*held)--;
+        if (requeue(msg.index, st, dq_time))
+            return -1;
+    }
+}
+
+/*
+ * Stream until max_frames frames were captured or seconds elapsed (0 means
+ * no limit for either). Every wakeup drains all buffers the driver has
+ * filled. They are handed back right away, after an inline save, or once
+ * the worker thread or the remote consumer is done with them.
+ */
+static int stream_frames(unsigned long max_frames, unsigned int seconds,
+        enum save_mode mode)
+{
+    struct epoll_event ev;
+    struct v4l2_buffer buf;
+    struct stream_stats st;
+    struct frame_writer w;
+    struct frame_job job;
+    unsigned long long *dq_time;
+    bool *lent;
+    unsigned long long start, deadline, elapsed;
+    unsigned int index;
+    unsigned int held = 0, peak_held = 0;
+    bool threaded = mode == SAVE_THREAD || mode == SHARE_LOCAL || mode == PREVIEW;
+    bool handoff = threaded || mode == SHARE_REMOTE;
+    const char *worker = mode == SAVE_THREAD ? "writer" : mode == PREVIEW ? "encoder" : "consumer";
+    eventfd_t cnt;
+    bool kick;
+    int epfd;
+    int timeout;
+    int ret = 0;
+
+    memset(&st, 0, sizeof(st));
+    start = now_ns();
+    w.jobs = NULL;
+    w.done = NULL;
+    w.job_efd = -1;
+    w.done_efd = -1;
+    dq_time = (unsigned long long *)calloc(n_buffers, sizeof(*dq_time));
+    lent = (bool *)calloc(n_buffers, sizeof(*lent));
+
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) {
+        printf("[%s]%d, epoll_create1 failed: %s\n", __func__, __LINE__, strerror(errno));
+        free(dq_time);
+        free(lent);
+        return -1;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev)) {
+        printf("[%s]%d, epoll_ctl failed: %s\n", __func__, __LINE__, strerror(errno));
+        ret = -1;
+        goto out;
+    }
+
+    if (threaded) {
+        if (writer_start(&w, mode == SHARE_LOCAL ? consume_frame :
+                    mode == PREVIEW ? preview_frame : save_frame, mode == PREVIEW)) {
+            ret = -1;
+            goto out;
         }
+        ev.data.fd = w.done_efd;
+    } else if (mode == SHARE_REMOTE) {
+        ev.data.fd = share_sock;
+    }
+    if (handoff && epoll_ctl(epfd, EPOLL_CTL_ADD, ev.data.fd, &ev)) {
+        printf("[%s]%d, epoll_ctl failed: %s\n", __func__, __LINE__, strerror(errno));
+        ret = -1;
+        goto out;
+    }
+
+    start = now_ns();
+    deadline = seconds ? start + seconds * 1000000000ULL : 0;
 
-        usleep(100000);
-        printf("[%s]%d\n", __func__, __LINE__);
-        ret = write(f_id, buffers[buf.index].start, buffers[buf.index].length);
+    while (!stop_streaming) {
+        if (max_frames && st.frames >= max_frames)
+            break;
+
+        timeout = FRAME_TIMEOUT_MS;
+        if (deadline) {
+            unsigned long long now = now_ns();
+
+            if (now >= deadline)
+                break;
+            if ((deadline - now) / 1000000 < (unsigned long long)timeout)
+                timeout = (deadline - now) / 1000000 + 1;
+        }
+
+        ret = epoll_wait(epfd, &ev, 1, timeout);
         if (ret < 0) {
-            printf("[%s]%d, failed!\n", __func__, __LINE__);
-            return ret;
+            if (errno == EINTR)
+                continue;
+            printf("[%s]%d, epoll_wait failed: %s\n", __func__, __LINE__, strerror(errno));
+            break;
+        }
+        if (ret == 0) {
+            if (deadline && now_ns() >= deadline)
+                break;
+            printf("[%s]%d, no frame for %d ms\n", __func__, __LINE__, timeout);
+            ret = -ETIMEDOUT;
+            break;
         }
+        ret = 0;
 
-        printf("[%s]%d, ---------VIDIOC_QBUF------------\n", __func__, __LINE__);
+        /* buffers the consumer is done with go back to the driver first */
+        if (threaded) {
+            eventfd_read(w.done_efd, &cnt);
+            while (w.done->pop(index)) {
+                lent[index] = false;
+                held--;
+                if (requeue(index, &st, dq_time)) {
+                    ret = -1;
+                    goto out;
+                }
+            }
+        } else if (mode == SHARE_REMOTE) {
+            if (reclaim_remote(&st, dq_time, lent, &held)) {
+                ret = -1;
+                goto out;
+            }
+        }
 
-        ret = ioctl(fd, VIDIOC_QBUF, &buf);
-        if (ret) {
-            printf("[%s]%d, failed!\n", __func__, __LINE__);
-            return ret;
-	
+        kick = false;
+        for (;;) {
+            memset(&buf, 0, sizeof(buf));
+            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            buf.memory = memory;
+            if (ioctl(fd, VIDIOC_DQBUF, &buf)) {
+                if (errno == EAGAIN)
+                    break;
+                printf("[%s]%d, VIDIOC_DQBUF failed: %s\n", __func__, __LINE__, strerror(errno));
+                ret = -1;
+                goto out;
+            }
+            dq_time[buf.index] = now_ns();
+            account_frame(&st, &buf);
+
+            job.index = buf.index;
+            job.bytesused = buf.bytesused;
+            job.sequence = buf.sequence;
+            job.n = st.frames - 1;
+            job.timestamp_ns = buf.timestamp.tv_sec * 1000000000ULL +
+                buf.timestamp.tv_usec * 1000ULL;
+
+            if (handoff) {
+                /* keep the driver fed: drop the frame rather than starve it */
+                if (held + MIN_QUEUED >= n_buffers) {
+                    st.backpressure++;
+                } else {
+                    if (threaded) {
+                        w.jobs->push(job);
+                        kick = true;
+                    } else if (share_frame(&job)) {
+                        ret = -1;
+                        goto out;
+                    }
+                    if (mode == SHARE_LOCAL || mode == SHARE_REMOTE)
+                        st.shared_bytes += job.bytesused;
+                    lent[buf.index] = true;
+                    if (++held > peak_held)
+                        peak_held = held;
+                    goto next;
+                }
+            } else if (mode == SAVE_INLINE) {
+                save_frame(&job);
+            }
+
+            if (requeue(buf.index, &st, dq_time)) {
+                ret = -1;
+                goto out;
+            }
+next:
+            if (max_frames && st.frames >= max_frames)
+                break;
+        }
+        if (kick)
+            eventfd_write(w.job_efd, 1);
+    }
+
+out:
+    elapsed = now_ns() - start;
+    if (threaded)
+        writer_stop(&w, &st);
+    close(epfd);
+    free(dq_time);
+    free(lent);
+
+    printf("frames: %lu in %.3f s, %.2f fps (%s buffers)\n", st.frames, elapsed / 1e9,
+            elapsed ? st.frames * 1e9 / elapsed : 0.0,
+            memory == V4L2_MEMORY_USERPTR ? "USERPTR" : "MMAP");
+    printf("dropped (sequence gaps): %lu\n", st.dropped);
+    printf("DQBUF->QBUF hold: avg %.1f us, max %.1f us\n",
+            st.frames ? st.hold_ns / 1e3 / st.frames : 0.0, st.hold_max_ns / 1e3);
+    if (handoff) {
+        printf("dropped (%s backpressure): %lu\n", worker, st.backpressure);
+        printf("%s backlog: peak %u of %lu buffers, %d kept queued\n",
+                worker, peak_held, n_buffers, MIN_QUEUED);
+        if (st.bad_returns)
+            printf("ignored returns (buffer not lent out): %lu\n", st.bad_returns);
+    }
+    if (mode == PREVIEW) {
+        printf("skipped (older than the newest queued frame): %lu\n", st.stale);
+        printf("encode: %lu frames, avg %.2f ms, max %.2f ms\n", encoded,
+                encoded ? encode_ns / 1e6 / encoded : 0.0, encode_max_ns / 1e6);
+    }
+    if (mode == SHARE_LOCAL || mode == SHARE_REMOTE) {
+        /* the write path copies every saved frame once into the page cache */
+        printf("shared by dma-buf: %.1f MB, copies avoided %.1f MB/s\n",
+                st.shared_bytes / 1e6,
+                elapsed ? st.shared_bytes * 1e3 / elapsed : 0.0);
+    }
+
+    return ret;
+}
+
+/*
+ * Export every capture buffer as a dma-buf. The fds stay valid (and keep
+ * the buffer alive) independently of the V4L2 mmap mappings.
+ */
+static int export_buffers(bool map)
+{
+    struct v4l2_exportbuffer exp;
+    unsigned long i;
+
+    if (n_buffers > DMABUF_MAX_BUFFERS) {
+        printf("[%s]%d, at most %d buffers can be shared\n", __func__, __LINE__, DMABUF_MAX_BUFFERS);
+        return -1;
+    }
+
+    views = (struct dmabuf_view *)calloc(n_buffers, sizeof(*views));
+    for (i = 0; i < n_buffers; i++) {
+        memset(&exp, 0, sizeof(exp));
+        exp.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        exp.index = i;
+        exp.flags = O_RDONLY | O_CLOEXEC;
+        if (ioctl(fd, VIDIOC_EXPBUF, &exp)) {
+            printf("[%s]%d, VIDIOC_EXPBUF failed: %s\n", __func__, __LINE__, strerror(errno));
+            return -1;
+        }
+        buffers[i].dmabuf_fd = exp.fd;
+        if (map && dmabuf_view_map(&views[i], exp.fd, buffers[i].length)) {
+            printf("[%s]%d, mmap of dma-buf %lu failed: %s\n", __func__, __LINE__, i, strerror(errno));
+            return -1;
         }
+    }
+    return 0;
+}
+
+/* wait for one consumer and give it the format and every buffer fd */
+static int serve_consumer(const char *path)
+{
+    struct dmabuf_hello hello;
+    int fds[DMABUF_MAX_BUFFERS];
+    unsigned long i;
+    int lsock;
+    int ret;
 
-        close(f_id);
+    lsock = dmabuf_listen(path);
+    if (lsock < 0) {
+        printf("[%s]%d, listen on %s failed: %s\n", __func__, __LINE__, path, strerror(-lsock));
+        return -1;
+    }
+    printf("waiting for a consumer on %s\n", path);
+    share_sock = accept4(lsock, NULL, NULL, SOCK_CLOEXEC);
+    close(lsock);
+    unlink(path);
+    if (share_sock < 0) {
+        printf("[%s]%d, accept failed: %s\n", __func__, __LINE__, strerror(errno));
+        return -1;
     }
 
-    return 1;
+    memset(&hello, 0, sizeof(hello));
+    hello.count = n_buffers;
+    hello.length = buffers[0].length;
+    hello.width = pix.width;
+    hello.height = pix.height;
+    hello.bytesperline = pix.bytesperline;
+    hello.pixelformat = pix.pixelformat;
+    for (i = 0; i < n_buffers; i++)
+        fds[i] = buffers[i].dmabuf_fd;
+    ret = dmabuf_send_fds(share_sock, &hello, sizeof(hello), fds, n_buffers);
+    if (ret) {
+        printf("[%s]%d, sending buffers failed: %s\n", __func__, __LINE__, strerror(-ret));
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Stripe order comes from the bridge's link and output order registers;
+ * without register access assume the driver default, links in order.
+ */
+static int setup_demux(void)
+{
+    struct stack_view views[STACK_MAX_CAMERAS];
+    unsigned int i;
+    int ret;
+
+    ret = stack_layout_read(fd, &layout);
+    if (ret) {
+        printf("[%s]%d, cannot read link registers (%s), assuming links 0..%u\n",
+                __func__, __LINE__, strerror(-ret), pix.height / CAMERA_HEIGHT - 1);
+        stack_layout_default(pix.height / CAMERA_HEIGHT, &layout);
+    }
+
+    if (stack_views(&layout, NULL, pix.bytesperline, pix.width, pix.height, views) < 0) {
+        printf("[%s]%d, %u lines do not split into %u cameras\n",
+                __func__, __LINE__, pix.height, layout.count);
+        return -1;
+    }
+    for (i = 0; i < layout.count; i++)
+        printf("camera %u: link %d, rows %u..%u\n", i, layout.link[i],
+                i * views[i].height, (i + 1) * views[i].height - 1);
+
+    if (!stack_view_contiguous(&views[0], 2)) {
+        split_pool = frame_pool_create(views[0].width * 2 * views[0].height, layout.count);
+        splitter = stack_splitter_create(layout.count);
+        if (!split_pool)
+            return -1;
+    }
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    cout << "usage: " << prog << " [-n frames] [-t seconds] [-s | -a | -x | -X socket | -p port] [-b buffers] [-u] [-D] [-o archive] <video_num>" << endl;
+    cout << "  -n  stop after this many frames (default " << PIC_CNT << " without -t)" << endl;
+    cout << "  -t  stop after this many seconds" << endl;
+    cout << "  -s  stream only, do not save frames to /sdcard/Movies" << endl;
+    cout << "  -a  save frames from a writer thread instead of the capture loop" << endl;
+    cout << "  -b  number of driver buffers to request (default " << PIC_CNT << ")" << endl;
+    cout << "  -o  append frames to one indexed archive file instead of a file per frame" << endl;
+    cout << "  -u  capture into a huge-page USERPTR pool instead of driver (MMAP) buffers" << endl;
+    cout << "  -D  save each camera of a max9286 stacked frame separately" << endl;
+    cout << "  -x  export buffers as dma-buf and read them from an in-process consumer" << endl;
+    cout << "  -X  export buffers as dma-buf and serve them to DmabufConsumer on this socket" << endl;
+    cout << "  -p  serve an MJPEG preview on this TCP port (" << PREVIEW_PORT << " for myPython.py), until Ctrl-C without -n/-t" << endl;
+    cout << "  -j  encode the preview in this many stripes in parallel (default 1)" << endl;
+    cout << "  -q  preview JPEG quality (default " << PREVIEW_QUALITY << ")" << endl;
 }
 
 int main(int argc, char *argv[])
@@ -98,16 +758,84 @@ int main(int argc, char *argv[])
     struct v4l2_requestbuffers req;
     struct v4l2_buffer buf;
     enum v4l2_buf_type type;
-    int i;
+    unsigned long i;
     int ret;
+    int opt;
     char dev_name[16];
+    unsigned long max_frames = 0;
+    unsigned int seconds = 0;
+    unsigned int n_req = PIC_CNT;
+    enum save_mode mode = SAVE_INLINE;
+    const char *archive_path = NULL;
+    const char *share_path = NULL;
+    unsigned short port = PREVIEW_PORT;
+    unsigned int stripes = 1;
+    int quality = PREVIEW_QUALITY;
 
-    if (argc !=2) {
+    while ((opt = getopt(argc, argv, "n:t:sab:o:xX:uDp:j:q:")) != -1) {
+        switch (opt) {
+        case 'n':
+            max_frames = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            seconds = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            mode = SAVE_NONE;
+            break;
+        case 'a':
+            mode = SAVE_THREAD;
+            break;
+        case 'b':
+            n_req = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            archive_path = optarg;
+            break;
+        case 'D':
+            demux = true;
+            break;
+        case 'u':
+            memory = V4L2_MEMORY_USERPTR;
+            break;
+        case 'x':
+            mode = SHARE_LOCAL;
+            break;
+        case 'X':
+            mode = SHARE_REMOTE;
+            share_path = optarg;
+            break;
+        case 'p':
+            mode = PREVIEW;
+            port = strtoul(optarg, NULL, 0);
+            break;
+        case 'j':
+            stripes = strtoul(optarg, NULL, 0);
+            break;
+        case 'q':
+            quality = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (optind != argc - 1) {
         cout << "invalid param!" << endl;
+        usage(argv[0]);
         return argc;
     }
 
-    ret = snprintf(dev_name, 16, "/dev/video%d", atoi(argv[1]));
+    if (!max_frames && !seconds && mode != PREVIEW)
+        max_frames = PIC_CNT;
+
+    if (memory == V4L2_MEMORY_USERPTR && (mode == SHARE_LOCAL || mode == SHARE_REMOTE)) {
+        cout << "-u cannot be combined with -x/-X: only driver buffers can be exported" << endl;
+        return -1;
+    }
+
+    ret = snprintf(dev_name, 16, "/dev/video%d", atoi(argv[optind]));
     if (ret < 0) {
         cout << "Get dev name error!" << endl;
         return ret;
@@ -116,6 +844,10 @@ int main(int argc, char *argv[])
     cout << "dev name is " << dev_name << endl;
 
     fd = open(dev_name, O_RDWR| O_NONBLOCK, 0);
+    if (fd < 0) {
+        cout << "open " << dev_name << " failed: " << strerror(errno) << endl;
+        return -1;
+    }
 
     ret = ioctl(fd, VIDIOC_QUERYCAP, &cap);
     if (ret){
@@ -140,6 +872,7 @@ int main(int argc, char *argv[])
     cout <<"device_caps:0X" << hex  << cap.device_caps<< endl;
 
     usleep(1000);
+    memset(&fmt, 0, sizeof(fmt));
     fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
     fmt.fmt.pix.width = 1280;
     fmt.fmt.pix.height = 800;//720;
@@ -151,10 +884,39 @@ int main(int argc, char *argv[])
         cout << __func__<< ":" << dec << __LINE__ << "==>>ret is "<< dec << ret << endl;
         return ret;
     }
+    pix = fmt.fmt.pix;
+
+    if (mode == PREVIEW) {
+        if (pix.pixelformat != V4L2_PIX_FMT_YUYV) {
+            cout << "preview needs YUYV frames" << endl;
+            return -1;
+        }
+        encoder = mjpeg_encoder_create(pix.width, pix.height, quality, stripes);
+        if (!encoder)
+            return -1;
+        preview = preview_start(port);
+        if (!preview)
+            return -1;
+    }
 
-    req.count = PIC_CNT;
+    if (demux) {
+        ret = setup_demux();
+        if (ret)
+            return ret;
+    }
+
+    if (archive_path && (mode == SAVE_INLINE || mode == SAVE_THREAD)) {
+        /* 30 fps worth of room per requested second */
+        archive = archive_create(archive_path, pix.sizeimage,
+                max_frames ? max_frames : seconds * 30UL, true);
+        if (!archive)
+            return -1;
+    }
+
+    memset(&req, 0, sizeof(req));
+    req.count = n_req;
     req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-    req.memory = V4L2_MEMORY_MMAP;
+    req.memory = memory;
     ret = ioctl(fd, VIDIOC_REQBUFS, &req);
     if (ret) {
         cout << __func__<< ":" << __LINE__ << "ret is " << ret << endl;
@@ -163,8 +925,22 @@ int main(int argc, char *argv[])
 
     buffers = (struct buffer *)calloc(req.count, sizeof(*buffers));
 
+    if (memory == V4L2_MEMORY_USERPTR) {
+        pool = frame_pool_create(pix.sizeimage, req.count);
+        if (!pool)
+            return -1;
+        cout << "USERPTR pool: " << dec << req.count << " x " << frame_pool_frame_size(pool)
+            << " bytes on " << frame_pool_backing_name(frame_pool_backing(pool)) << endl;
+        for (n_buffers = 0; n_buffers < req.count; n_buffers++) {
+            buffers[n_buffers].start = frame_pool_frame(pool, n_buffers);
+            buffers[n_buffers].length = frame_pool_frame_size(pool);
+            buffers[n_buffers].dmabuf_fd = -1;
+        }
+    }
+
     cout << __func__<< ":" << dec << __LINE__ << endl;
-    for (n_buffers = 0; n_buffers < req.count; n_buffers++) {
+    for (n_buffers = 0; memory == V4L2_MEMORY_MMAP && n_buffers < req.count; n_buffers++) {
+        memset(&buf, 0, sizeof(buf));
         buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
         buf.memory = V4L2_MEMORY_MMAP;
         buf.index = n_buffers;
@@ -177,18 +953,29 @@ int main(int argc, char *argv[])
 
         buffers[n_buffers].length = buf.length;
         buffers[n_buffers].start = mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, buf.m.offset);
+        if (buffers[n_buffers].start == MAP_FAILED) {
+            cout << __func__<< ":" << __LINE__ << "mmap failed: " << strerror(errno) << endl;
+            return -1;
+        }
+        buffers[n_buffers].dmabuf_fd = -1;
+    }
+
+    if (mode == SHARE_LOCAL || mode == SHARE_REMOTE) {
+        ret = export_buffers(mode == SHARE_LOCAL);
+        if (ret)
+            return ret;
+    }
+    if (mode == SHARE_REMOTE) {
+        ret = serve_consumer(share_path);
+        if (ret)
+            return ret;
     }
 
     cout << __func__<< ":" << dec << __LINE__ << endl;
     for (i = 0; i < n_buffers; i++){
-        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-        buf.memory =  V4L2_MEMORY_MMAP;
-        buf.index = i;
-        ret = ioctl(fd, VIDIOC_QBUF, &buf);
-        if (ret) {
-            cout << __func__<< ":" << __LINE__ << "ret is " << ret << endl;
+        ret = queue_buffer(i);
+        if (ret)
             return ret;
-        }
     }
 
     cout << __func__<< ":" << dec << __LINE__ << endl;
@@ -199,32 +986,43 @@ int main(int argc, char *argv[])
         return ret;
     }
 
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
     cout << __func__<< ":" << dec << __LINE__ << endl;
-    fd_set fds;
+    ret = stream_frames(max_frames, seconds, mode);
+
+    type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    ioctl(fd, VIDIOC_STREAMOFF, &type);
 
-    FD_ZERO(&fds);
-    FD_SET(fd, &fds);
+    if (archive && archive_close(archive))
+        cout << "closing " << archive_path << " failed" << endl;
 
-    cout << __func__<< ":" << dec << __LINE__ << endl;
-    ret = select(fd + 1, &fds, NULL, NULL, NULL);
-    if (ret > 0) {
-        if (FD_ISSET(fd, &fds)) {
-            cout << __func__<< ":" << dec << __LINE__ << endl;
-            read_frame();
-        } else {
-            cout << __func__<< ":" << dec << __LINE__ << endl;
-        }
-    }
+    if (share_sock >= 0)
+        close(share_sock);
+
+    if (preview)
+        preview_stop(preview);
+    mjpeg_encoder_destroy(encoder);
 
     cout << __func__<< ":" << dec << __LINE__ << endl;
     for (i = 0; i < n_buffers; i++){
-        munmap(buffers[i].start, buffers[i].length);
+        if (views)
+            dmabuf_view_unmap(&views[i]);
+        if (buffers[i].dmabuf_fd >= 0)
+            close(buffers[i].dmabuf_fd);
+        if (memory == V4L2_MEMORY_MMAP)
+            munmap(buffers[i].start, buffers[i].length);
     }
+    frame_pool_destroy(pool);
+    if (splitter)
+        stack_splitter_destroy(splitter);
+    frame_pool_destroy(split_pool);
 
     cout << __func__<< ":" << dec << __LINE__ << endl;
     close(fd);
     cout << "Camera done.\n" << endl;
 
     cout << __func__<< ":" << dec << __LINE__ << endl;
-    return 0;
+    return ret;
 }
@@ -0,0 +1,117 @@
+#define LOG_TAG "DmabufConsumer"
+
+#include <iostream>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include "dmabuf_share.h"
+
+using namespace std;
+
+/*
+ * Out-of-process counterpart of CameraCapture -X: maps the capture buffers
+ * it is given once, then reads each announced frame in place and hands the
+ * buffer back by index.
+ */
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static unsigned long long consume(const struct dmabuf_view *v, unsigned int len)
+{
+    const unsigned long long *p = (const unsigned long long *)v->addr;
+    size_t i, n = len / sizeof(*p);
+    unsigned long long sum = 0;
+
+    dmabuf_begin_read(v);
+    for (i = 0; i < n; i += 64 / sizeof(*p))
+        sum += p[i];
+    dmabuf_end_read(v);
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    struct dmabuf_hello hello;
+    struct dmabuf_frame_msg msg;
+    struct dmabuf_view views[DMABUF_MAX_BUFFERS];
+    int fds[DMABUF_MAX_BUFFERS];
+    unsigned long frames = 0;
+    unsigned long long bytes = 0, sum = 0;
+    unsigned long long start, elapsed, hold_us = 0;
+    unsigned int i;
+    int nfds;
+    int sock;
+    ssize_t n;
+
+    if (argc < 2 || argc > 3) {
+        cout << "usage: " << argv[0] << " <socket> [hold_us]" << endl;
+        return -1;
+    }
+    if (argc == 3)
+        hold_us = strtoul(argv[2], NULL, 0);
+
+    sock = dmabuf_connect(argv[1]);
+    if (sock < 0) {
+        printf("[%s]%d, connect %s failed: %s\n", __func__, __LINE__, argv[1], strerror(-sock));
+        return -1;
+    }
+
+    nfds = dmabuf_recv_fds(sock, &hello, sizeof(hello), fds, DMABUF_MAX_BUFFERS);
+    if (nfds < 0 || (unsigned int)nfds != hello.count) {
+        printf("[%s]%d, bad hello (%d fds)\n", __func__, __LINE__, nfds);
+        return -1;
+    }
+    printf("%u buffers of %u bytes, %ux%u fourcc %.4s\n", hello.count, hello.length,
+            hello.width, hello.height, (const char *)&hello.pixelformat);
+
+    for (i = 0; i < hello.count; i++) {
+        if (dmabuf_view_map(&views[i], fds[i], hello.length)) {
+            printf("[%s]%d, mmap of buffer %u failed: %s\n", __func__, __LINE__, i, strerror(errno));
+            return -1;
+        }
+    }
+
+    start = now_ns();
+    for (;;) {
+        n = recv(sock, &msg, sizeof(msg), 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        if (n != sizeof(msg) || msg.index >= hello.count)
+            continue;
+
+        sum += consume(&views[msg.index], msg.bytesused);
+        if (hold_us)
+            usleep(hold_us);
+        frames++;
+        bytes += msg.bytesused;
+
+        if (send(sock, &msg, sizeof(msg), MSG_NOSIGNAL) != sizeof(msg))
+            break;
+    }
+    elapsed = now_ns() - start;
+
+    printf("consumed %lu frames, %.1f MB in %.3f s: %.2f fps, %.1f MB/s without copies (sum %llx)\n",
+            frames, bytes / 1e6, elapsed / 1e9,
+            elapsed ? frames * 1e9 / elapsed : 0.0,
+            elapsed ? bytes * 1e3 / elapsed : 0.0, sum);
+
+    for (i = 0; i < hello.count; i++) {
+        dmabuf_view_unmap(&views[i]);
+        close(fds[i]);
+    }
+    close(sock);
+    return 0;
+}
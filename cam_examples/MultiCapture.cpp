@@ -0,0 +1,467 @@
+#define LOG_TAG "MultiCapture"
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <linux/videodev2.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <errno.h>
+
+using namespace std;
+
+/*
+ * Streams several video nodes (typically the max9286 and max9288
+ * deserializers) from one process. Either one epoll loop serves every
+ * node, or each node gets its own thread pinned to a CPU. All frames land
+ * on one CLOCK_MONOTONIC timeline so cameras can be compared.
+ */
+
+#define MAX_DEVICES 8
+#define DEFAULT_BUFFERS 4
+#define FRAME_TIMEOUT_MS 2000
+
+struct buffer {
+    void *                  start;
+    size_t                  length;
+};
+
+struct frame_record {
+    unsigned int            sequence;
+    unsigned long long      timestamp_ns;
+    unsigned long long      dq_ns;
+};
+
+struct capture_dev {
+    char                    name[16];
+    int                     fd;
+    int                     cpu;
+    struct v4l2_pix_format  pix;
+    struct buffer *         buffers;
+    unsigned int            n_buffers;
+    /* buffer timestamps are CLOCK_MONOTONIC, otherwise use DQBUF time */
+    bool                    mono_ts;
+    bool                    failed;
+    /* statistics */
+    unsigned long           frames;
+    unsigned long           dropped;
+    unsigned int            last_seq;
+    unsigned long long      first_ns;
+    unsigned long long      last_ns;
+    unsigned long long      latency_ns;
+    unsigned long long      latency_max_ns;
+    vector<frame_record>    timeline;
+};
+
+static struct capture_dev devs[MAX_DEVICES];
+static unsigned int n_devs;
+static unsigned long max_frames;
+static unsigned long long deadline;
+static volatile sig_atomic_t stop_streaming;
+
+static void on_signal(int sig)
+{
+    stop_streaming = 1;
+}
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int open_device(struct capture_dev *d, int video_num, unsigned int n_req)
+{
+    struct v4l2_format fmt;
+    struct v4l2_requestbuffers req;
+    struct v4l2_buffer buf;
+    enum v4l2_buf_type type;
+    unsigned int i;
+
+    snprintf(d->name, sizeof(d->name), "/dev/video%d", video_num);
+    d->fd = open(d->name, O_RDWR | O_NONBLOCK | O_CLOEXEC, 0);
+    if (d->fd < 0) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+        return -1;
+    }
+
+    memset(&fmt, 0, sizeof(fmt));
+    fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    fmt.fmt.pix.width = 1280;
+    fmt.fmt.pix.height = 800;
+    fmt.fmt.pix.field = V4L2_FIELD_INTERLACED;
+    fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_YUYV;
+    if (ioctl(d->fd, VIDIOC_S_FMT, &fmt)) {
+        printf("[%s]%d, %s VIDIOC_S_FMT failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+        return -1;
+    }
+    d->pix = fmt.fmt.pix;
+
+    memset(&req, 0, sizeof(req));
+    req.count = n_req;
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(d->fd, VIDIOC_REQBUFS, &req)) {
+        printf("[%s]%d, %s VIDIOC_REQBUFS failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+        return -1;
+    }
+
+    d->buffers = (struct buffer *)calloc(req.count, sizeof(*d->buffers));
+    for (d->n_buffers = 0; d->n_buffers < req.count; d->n_buffers++) {
+        memset(&buf, 0, sizeof(buf));
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = d->n_buffers;
+        if (ioctl(d->fd, VIDIOC_QUERYBUF, &buf)) {
+            printf("[%s]%d, %s VIDIOC_QUERYBUF failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+            return -1;
+        }
+        d->mono_ts = (buf.flags & V4L2_BUF_FLAG_TIMESTAMP_MASK) ==
+            V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC;
+        d->buffers[d->n_buffers].length = buf.length;
+        d->buffers[d->n_buffers].start = mmap(NULL, buf.length, PROT_READ | PROT_WRITE,
+                MAP_SHARED, d->fd, buf.m.offset);
+        if (d->buffers[d->n_buffers].start == MAP_FAILED) {
+            printf("[%s]%d, %s mmap failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+            return -1;
+        }
+    }
+
+    for (i = 0; i < d->n_buffers; i++) {
+        memset(&buf, 0, sizeof(buf));
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = i;
+        if (ioctl(d->fd, VIDIOC_QBUF, &buf)) {
+            printf("[%s]%d, %s VIDIOC_QBUF failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+            return -1;
+        }
+    }
+
+    type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (ioctl(d->fd, VIDIOC_STREAMON, &type)) {
+        printf("[%s]%d, %s VIDIOC_STREAMON failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+        return -1;
+    }
+
+    printf("%s: %ux%u, %u buffers, %s timestamps\n", d->name, d->pix.width, d->pix.height,
+            d->n_buffers, d->mono_ts ? "monotonic" : "dequeue");
+    return 0;
+}
+
+static void close_device(struct capture_dev *d)
+{
+    enum v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    unsigned int i;
+
+    if (d->fd < 0)
+        return;
+    ioctl(d->fd, VIDIOC_STREAMOFF, &type);
+    for (i = 0; i < d->n_buffers; i++)
+        munmap(d->buffers[i].start, d->buffers[i].length);
+    free(d->buffers);
+    close(d->fd);
+    d->fd = -1;
+}
+
+static bool device_done(const struct capture_dev *d)
+{
+    return d->failed || (max_frames && d->frames >= max_frames);
+}
+
+/* dequeue everything the driver has filled and hand it straight back */
+static int drain_device(struct capture_dev *d)
+{
+    struct v4l2_buffer buf;
+    struct frame_record rec;
+    unsigned long long ts;
+
+    while (!device_done(d)) {
+        memset(&buf, 0, sizeof(buf));
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        if (ioctl(d->fd, VIDIOC_DQBUF, &buf)) {
+            if (errno == EAGAIN)
+                return 0;
+            printf("[%s]%d, %s VIDIOC_DQBUF failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+            d->failed = true;
+            return -1;
+        }
+
+        rec.dq_ns = now_ns();
+        rec.sequence = buf.sequence;
+        ts = buf.timestamp.tv_sec * 1000000000ULL + buf.timestamp.tv_usec * 1000ULL;
+        rec.timestamp_ns = d->mono_ts ? ts : rec.dq_ns;
+
+        if (d->frames && buf.sequence > d->last_seq + 1)
+            d->dropped += buf.sequence - d->last_seq - 1;
+        if (!d->frames)
+            d->first_ns = rec.timestamp_ns;
+        d->last_seq = buf.sequence;
+        d->last_ns = rec.timestamp_ns;
+        d->frames++;
+        if (d->mono_ts && rec.dq_ns > ts) {
+            d->latency_ns += rec.dq_ns - ts;
+            if (rec.dq_ns - ts > d->latency_max_ns)
+                d->latency_max_ns = rec.dq_ns - ts;
+        }
+        d->timeline.push_back(rec);
+
+        if (ioctl(d->fd, VIDIOC_QBUF, &buf)) {
+            printf("[%s]%d, %s VIDIOC_QBUF failed: %s\n", __func__, __LINE__, d->name, strerror(errno));
+            d->failed = true;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int wait_timeout(void)
+{
+    unsigned long long now;
+
+    if (!deadline)
+        return FRAME_TIMEOUT_MS;
+    now = now_ns();
+    if (now >= deadline)
+        return 0;
+    if ((deadline - now) / 1000000 < FRAME_TIMEOUT_MS)
+        return (deadline - now) / 1000000 + 1;
+    return FRAME_TIMEOUT_MS;
+}
+
+/* one epoll set over devs[first..first+count) */
+static void stream_loop(unsigned int first, unsigned int count)
+{
+    struct epoll_event ev[MAX_DEVICES];
+    unsigned int i, active;
+    int epfd, n, timeout;
+
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) {
+        printf("[%s]%d, epoll_create1 failed: %s\n", __func__, __LINE__, strerror(errno));
+        return;
+    }
+    for (i = first; i < first + count; i++) {
+        memset(&ev[0], 0, sizeof(ev[0]));
+        ev[0].events = EPOLLIN;
+        ev[0].data.u32 = i;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, devs[i].fd, &ev[0]);
+    }
+
+    active = count;
+    while (active && !stop_streaming) {
+        timeout = wait_timeout();
+        if (!timeout)
+            break;
+        n = epoll_wait(epfd, ev, MAX_DEVICES, timeout);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            printf("[%s]%d, epoll_wait failed: %s\n", __func__, __LINE__, strerror(errno));
+            break;
+        }
+        if (n == 0) {
+            if (deadline && now_ns() >= deadline)
+                break;
+            printf("[%s]%d, no frame for %d ms\n", __func__, __LINE__, timeout);
+            break;
+        }
+        for (i = 0; i < (unsigned int)n; i++) {
+            struct capture_dev *d = &devs[ev[i].data.u32];
+
+            drain_device(d);
+            if (device_done(d)) {
+                epoll_ctl(epfd, EPOLL_CTL_DEL, d->fd, NULL);
+                active--;
+            }
+        }
+    }
+    close(epfd);
+}
+
+static void stream_thread(unsigned int i)
+{
+    cpu_set_t set;
+
+    if (devs[i].cpu >= 0) {
+        CPU_ZERO(&set);
+        CPU_SET(devs[i].cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+            printf("[%s]%d, %s: cannot pin to cpu %d\n", __func__, __LINE__, devs[i].name, devs[i].cpu);
+    }
+    stream_loop(i, 1);
+}
+
+/*
+ * For every frame of b, the distance to the closest frame of a on the
+ * shared timeline: how far apart the two cameras sample the scene.
+ */
+static void report_skew(const struct capture_dev *a, const struct capture_dev *b)
+{
+    const vector<frame_record> &ta = a->timeline, &tb = b->timeline;
+    unsigned long long sum = 0, max = 0, d;
+    size_t i, j = 0;
+
+    if (ta.empty() || tb.empty())
+        return;
+    for (i = 0; i < tb.size(); i++) {
+        while (j + 1 < ta.size() && ta[j + 1].timestamp_ns <= tb[i].timestamp_ns)
+            j++;
+        d = tb[i].timestamp_ns > ta[j].timestamp_ns ?
+            tb[i].timestamp_ns - ta[j].timestamp_ns : ta[j].timestamp_ns - tb[i].timestamp_ns;
+        if (j + 1 < ta.size() && ta[j + 1].timestamp_ns - tb[i].timestamp_ns < d)
+            d = ta[j + 1].timestamp_ns - tb[i].timestamp_ns;
+        sum += d;
+        if (d > max)
+            max = d;
+    }
+    printf("skew %s vs %s: avg %.3f ms, max %.3f ms\n", b->name, a->name,
+            sum / 1e6 / tb.size(), max / 1e6);
+}
+
+static void report(unsigned long long t0, const char *timeline_path)
+{
+    unsigned long long span;
+    unsigned int i;
+    size_t j;
+    FILE *f;
+
+    for (i = 0; i < n_devs; i++) {
+        struct capture_dev *d = &devs[i];
+
+        span = d->last_ns - d->first_ns;
+        printf("%s: %lu frames, %.2f fps, %lu dropped, first frame at +%.3f ms",
+                d->name, d->frames,
+                d->frames > 1 && span ? (d->frames - 1) * 1e9 / span : 0.0,
+                d->dropped, d->frames ? ((long long)(d->first_ns - t0)) / 1e6 : 0.0);
+        if (d->mono_ts && d->frames)
+            printf(", capture->DQBUF avg %.1f us max %.1f us",
+                    d->latency_ns / 1e3 / d->frames, d->latency_max_ns / 1e3);
+        printf("\n");
+    }
+    for (i = 1; i < n_devs; i++)
+        report_skew(&devs[0], &devs[i]);
+
+    if (!timeline_path)
+        return;
+    f = fopen(timeline_path, "w");
+    if (!f) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, timeline_path, strerror(errno));
+        return;
+    }
+    fprintf(f, "device,sequence,timestamp_ns,dqbuf_ns\n");
+    for (i = 0; i < n_devs; i++)
+        for (j = 0; j < devs[i].timeline.size(); j++)
+            fprintf(f, "%s,%u,%lld,%lld\n", devs[i].name, devs[i].timeline[j].sequence,
+                    (long long)(devs[i].timeline[j].timestamp_ns - t0),
+                    (long long)(devs[i].timeline[j].dq_ns - t0));
+    fclose(f);
+}
+
+static void usage(const char *prog)
+{
+    cout << "usage: " << prog << " [-n frames] [-t seconds] [-b buffers] [-p cpu,cpu,...] [-l timeline.csv] <video_num>..." << endl;
+    cout << "  -n  stop each stream after this many frames" << endl;
+    cout << "  -t  stop after this many seconds (default 10 without -n)" << endl;
+    cout << "  -b  driver buffers per device (default " << DEFAULT_BUFFERS << ")" << endl;
+    cout << "  -p  one thread per device, pinned to these CPUs in order (-1: unpinned);" << endl;
+    cout << "      without -p a single epoll loop serves every device" << endl;
+    cout << "  -l  write every frame as device,sequence,timestamp,dqbuf (ns from start)" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    vector<thread> workers;
+    const char *timeline_path = NULL;
+    const char *cpus = NULL;
+    unsigned int seconds = 0;
+    unsigned int n_req = DEFAULT_BUFFERS;
+    unsigned long long t0;
+    unsigned int i;
+    char *p;
+    int opt;
+    int ret = 0;
+
+    while ((opt = getopt(argc, argv, "n:t:b:p:l:")) != -1) {
+        switch (opt) {
+        case 'n':
+            max_frames = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            seconds = strtoul(optarg, NULL, 0);
+            break;
+        case 'b':
+            n_req = strtoul(optarg, NULL, 0);
+            break;
+        case 'p':
+            cpus = optarg;
+            break;
+        case 'l':
+            timeline_path = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (optind >= argc || argc - optind > MAX_DEVICES) {
+        cout << "invalid param!" << endl;
+        usage(argv[0]);
+        return -1;
+    }
+    if (!max_frames && !seconds)
+        seconds = 10;
+
+    for (i = 0; i < MAX_DEVICES; i++) {
+        devs[i].fd = -1;
+        devs[i].cpu = -1;
+    }
+    for (p = (char *)cpus, i = 0; p && *p && i < MAX_DEVICES; i++) {
+        devs[i].cpu = strtol(p, &p, 0);
+        if (*p == ',')
+            p++;
+    }
+
+    for (n_devs = 0; optind < argc; optind++, n_devs++) {
+        if (open_device(&devs[n_devs], atoi(argv[optind]), n_req)) {
+            ret = -1;
+            n_devs++;
+            goto out;
+        }
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    t0 = now_ns();
+    deadline = seconds ? t0 + seconds * 1000000000ULL : 0;
+    if (cpus) {
+        for (i = 0; i < n_devs; i++)
+            workers.push_back(thread(stream_thread, i));
+        for (i = 0; i < n_devs; i++)
+            workers[i].join();
+    } else {
+        stream_loop(0, n_devs);
+    }
+
+    report(t0, timeline_path);
+
+out:
+    for (i = 0; i < n_devs; i++)
+        close_device(&devs[i]);
+    return ret;
+}
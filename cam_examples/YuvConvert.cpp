@@ -0,0 +1,241 @@
+#define LOG_TAG "YuvConvert"
+
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include "yuv_convert.h"
+#include "png_write.h"
+
+using namespace std;
+
+/*
+ * Converts a raw YUYV/UYVY frame (e.g. mtk_yuyv0.data from CameraCapture)
+ * to PNG or to raw RGB24/RGBA/NV12/I420/gray. Replaces yuyv2png.py.
+ */
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static const struct {
+    const char *        name;
+    enum yuv_output     out;
+} outputs[] = {
+    { "rgb24", YUV_OUT_RGB24 },
+    { "rgba", YUV_OUT_RGBA },
+    { "nv12", YUV_OUT_NV12 },
+    { "i420", YUV_OUT_I420 },
+    { "gray", YUV_OUT_GRAY },
+};
+
+#define N_OUTPUTS (sizeof(outputs) / sizeof(outputs[0]))
+
+/*
+ * Every SIMD path must match the scalar reference byte for byte, for both
+ * input orders, every output, and widths that leave partial blocks.
+ */
+static int verify(const uint8_t *frame, unsigned int width, unsigned int height)
+{
+    static const enum yuv_isa isas[] = { YUV_ISA_SSE2, YUV_ISA_AVX2, YUV_ISA_NEON };
+    static const unsigned int widths[] = { 2, 14, 16, 18, 30, 32, 34, 62, 66, 1278 };
+    vector<uint8_t> random_frame, ref, out;
+    unsigned int i, j, k, in, w, fails = 0, runs = 0;
+
+    if (!frame) {
+        random_frame.resize((size_t)width * height * 2);
+        srand(1);
+        for (i = 0; i < random_frame.size(); i++)
+            random_frame[i] = rand();
+        frame = random_frame.data();
+    }
+
+    for (i = 0; i < sizeof(isas) / sizeof(isas[0]); i++) {
+        if (!yuv_isa_supported(isas[i])) {
+            printf("%-6s not supported here, skipped\n", yuv_isa_name(isas[i]));
+            continue;
+        }
+        for (in = YUV_YUYV; in <= YUV_UYVY; in++) {
+            for (j = 0; j < N_OUTPUTS; j++) {
+                for (k = 0; k <= sizeof(widths) / sizeof(widths[0]); k++) {
+                    /* the full frame, then narrow crops of it */
+                    w = k ? widths[k - 1] : width;
+                    if (w > width)
+                        continue;
+                    ref.assign(yuv_output_size(outputs[j].out, w, height), 0);
+                    out.assign(ref.size(), 0);
+                    yuv_convert(frame, width * 2, (enum yuv_packed)in, ref.data(),
+                            outputs[j].out, w, height, YUV_ISA_SCALAR);
+                    yuv_convert(frame, width * 2, (enum yuv_packed)in, out.data(),
+                            outputs[j].out, w, height, isas[i]);
+                    runs++;
+                    if (ref != out) {
+                        fails++;
+                        printf("MISMATCH %s %s -> %s width %u\n", yuv_isa_name(isas[i]),
+                                in == YUV_UYVY ? "uyvy" : "yuyv", outputs[j].name, w);
+                    }
+                }
+            }
+        }
+        printf("%-6s checked against scalar\n", yuv_isa_name(isas[i]));
+    }
+    printf("%u of %u conversions bit-exact\n", runs - fails, runs);
+    return fails ? -1 : 0;
+}
+
+static void usage(const char *prog)
+{
+    cout << "usage: " << prog << " [-f yuyv|uyvy] [-o png|rgb24|rgba|nv12|i420|gray] [-i isa] [-b n] <input> <width> <height> [output]" << endl;
+    cout << "       " << prog << " -v [<input> <width> <height>]" << endl;
+    cout << "  -f  input byte order (default yuyv)" << endl;
+    cout << "  -o  output format (default png, written to out.png)" << endl;
+    cout << "  -i  force scalar, sse2, avx2 or neon (default: best available, " << yuv_isa_name(yuv_best_isa()) << ")" << endl;
+    cout << "  -b  convert n times and report throughput" << endl;
+    cout << "  -v  check every SIMD path against the scalar reference" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    enum yuv_packed in = YUV_YUYV;
+    enum yuv_output out = YUV_OUT_RGB24;
+    enum yuv_isa isa = YUV_ISA_AUTO;
+    const char *format = "png";
+    const char *out_path = NULL;
+    const uint8_t *frame = NULL;
+    vector<uint8_t> dst;
+    unsigned long long start, elapsed;
+    unsigned int width = 1280, height = 800;
+    unsigned long bench = 0, i;
+    bool do_verify = false;
+    bool found;
+    struct stat st;
+    size_t need;
+    char name[32];
+    int opt, fd = -1;
+    int ret = 0;
+
+    while ((opt = getopt(argc, argv, "f:o:i:b:v")) != -1) {
+        switch (opt) {
+        case 'f':
+            in = strcmp(optarg, "uyvy") ? YUV_YUYV : YUV_UYVY;
+            break;
+        case 'o':
+            format = optarg;
+            break;
+        case 'i':
+            for (i = YUV_ISA_AUTO; i <= YUV_ISA_NEON; i++)
+                if (!strcmp(optarg, yuv_isa_name((enum yuv_isa)i)))
+                    isa = (enum yuv_isa)i;
+            break;
+        case 'b':
+            bench = strtoul(optarg, NULL, 0);
+            break;
+        case 'v':
+            do_verify = true;
+            break;
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (do_verify && optind == argc)
+        return verify(NULL, width, height);
+
+    if (argc - optind < 3 || argc - optind > 4) {
+        cout << "invalid param!" << endl;
+        usage(argv[0]);
+        return -1;
+    }
+    width = strtoul(argv[optind + 1], NULL, 0);
+    height = strtoul(argv[optind + 2], NULL, 0);
+    if (argc - optind == 4)
+        out_path = argv[optind + 3];
+
+    found = !strcmp(format, "png");
+    for (i = 0; i < N_OUTPUTS && !found; i++) {
+        if (!strcmp(format, outputs[i].name)) {
+            out = outputs[i].out;
+            found = true;
+        }
+    }
+    if (!found) {
+        cout << "unknown output format " << format << endl;
+        return -1;
+    }
+
+    fd = open(argv[optind], O_RDONLY | O_CLOEXEC);
+    if (fd < 0 || fstat(fd, &st)) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, argv[optind], strerror(errno));
+        return -1;
+    }
+    need = (size_t)width * height * 2;
+    if ((size_t)st.st_size < need) {
+        printf("[%s]%d, %s holds %lld bytes, %ux%u needs %zu\n", __func__, __LINE__,
+                argv[optind], (long long)st.st_size, width, height, need);
+        return -1;
+    }
+    frame = (const uint8_t *)mmap(NULL, need, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (frame == MAP_FAILED) {
+        printf("[%s]%d, mmap failed: %s\n", __func__, __LINE__, strerror(errno));
+        return -1;
+    }
+
+    if (do_verify) {
+        ret = verify(frame, width, height);
+        goto out;
+    }
+
+    printf("width=%u height=%u, %s\n", width, height,
+            yuv_isa_name(isa == YUV_ISA_AUTO ? yuv_best_isa() : isa));
+    dst.resize(yuv_output_size(out, width, height));
+    ret = yuv_convert(frame, width * 2, in, dst.data(), out, width, height, isa);
+    if (ret) {
+        printf("[%s]%d, conversion failed: %s\n", __func__, __LINE__, strerror(-ret));
+        goto out;
+    }
+
+    if (bench) {
+        start = now_ns();
+        for (i = 0; i < bench; i++)
+            yuv_convert(frame, width * 2, in, dst.data(), out, width, height, isa);
+        elapsed = now_ns() - start;
+        printf("%lu frames in %.3f s: %.1f fps, %.1f Mpixel/s\n", bench, elapsed / 1e9,
+                bench * 1e9 / elapsed, (double)bench * width * height * 1e3 / elapsed);
+    }
+
+    if (!out_path) {
+        snprintf(name, sizeof(name), "out.%s", format);
+        out_path = name;
+    }
+    if (!strcmp(format, "png")) {
+        ret = png_write_rgb(out_path, dst.data(), width, height);
+    } else {
+        FILE *f = fopen(out_path, "wb");
+
+        if (!f || fwrite(dst.data(), 1, dst.size(), f) != dst.size()) {
+            printf("[%s]%d, write %s failed: %s\n", __func__, __LINE__, out_path, strerror(errno));
+            ret = -1;
+        }
+        if (f)
+            fclose(f);
+    }
+
+out:
+    munmap((void *)frame, need);
+    close(fd);
+    return ret;
+}
@@ -0,0 +1,174 @@
+#include "dmabuf_share.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <linux/dma-buf.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+static int make_addr(struct sockaddr_un *addr, const char *path)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr->sun_path))
+        return -ENAMETOOLONG;
+    strcpy(addr->sun_path, path);
+    return 0;
+}
+
+int dmabuf_listen(const char *path)
+{
+    struct sockaddr_un addr;
+    int sock;
+
+    if (make_addr(&addr, path))
+        return -ENAMETOOLONG;
+
+    sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (sock < 0)
+        return -errno;
+
+    unlink(path);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) || listen(sock, 1)) {
+        int err = errno;
+
+        close(sock);
+        return -err;
+    }
+    return sock;
+}
+
+int dmabuf_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    int sock;
+
+    if (make_addr(&addr, path))
+        return -ENAMETOOLONG;
+
+    sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (sock < 0)
+        return -errno;
+
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr))) {
+        int err = errno;
+
+        close(sock);
+        return -err;
+    }
+    return sock;
+}
+
+int dmabuf_send_fds(int sock, const void *msg, size_t len, const int *fds, int nfds)
+{
+    char ctrl[CMSG_SPACE(sizeof(int) * DMABUF_MAX_BUFFERS)];
+    struct msghdr mh;
+    struct iovec iov;
+    struct cmsghdr *cm;
+
+    if (nfds > DMABUF_MAX_BUFFERS)
+        return -EINVAL;
+
+    memset(&mh, 0, sizeof(mh));
+    iov.iov_base = (void *)msg;
+    iov.iov_len = len;
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+
+    if (nfds) {
+        memset(ctrl, 0, sizeof(ctrl));
+        mh.msg_control = ctrl;
+        mh.msg_controllen = CMSG_SPACE(sizeof(int) * nfds);
+        cm = CMSG_FIRSTHDR(&mh);
+        cm->cmsg_level = SOL_SOCKET;
+        cm->cmsg_type = SCM_RIGHTS;
+        cm->cmsg_len = CMSG_LEN(sizeof(int) * nfds);
+        memcpy(CMSG_DATA(cm), fds, sizeof(int) * nfds);
+    }
+
+    if (sendmsg(sock, &mh, MSG_NOSIGNAL) != (ssize_t)len)
+        return -errno;
+    return 0;
+}
+
+int dmabuf_recv_fds(int sock, void *msg, size_t len, int *fds, int max_fds)
+{
+    char ctrl[CMSG_SPACE(sizeof(int) * DMABUF_MAX_BUFFERS)];
+    struct msghdr mh;
+    struct iovec iov;
+    struct cmsghdr *cm;
+    ssize_t ret;
+    int n = 0;
+
+    memset(&mh, 0, sizeof(mh));
+    iov.iov_base = msg;
+    iov.iov_len = len;
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+    mh.msg_control = ctrl;
+    mh.msg_controllen = sizeof(ctrl);
+
+    ret = recvmsg(sock, &mh, MSG_CMSG_CLOEXEC);
+    if (ret < 0)
+        return -errno;
+    if (ret != (ssize_t)len)
+        return -EPROTO;
+
+    for (cm = CMSG_FIRSTHDR(&mh); cm; cm = CMSG_NXTHDR(&mh, cm)) {
+        if (cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS)
+            continue;
+        n = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        if (n > max_fds)
+            n = max_fds;
+        memcpy(fds, CMSG_DATA(cm), sizeof(int) * n);
+    }
+    return n;
+}
+
+int dmabuf_view_map(struct dmabuf_view *v, int fd, size_t length)
+{
+    v->fd = fd;
+    v->length = length;
+    v->addr = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+    if (v->addr == MAP_FAILED) {
+        v->addr = NULL;
+        return -errno;
+    }
+    return 0;
+}
+
+void dmabuf_view_unmap(struct dmabuf_view *v)
+{
+    if (v->addr)
+        munmap(v->addr, v->length);
+    v->addr = NULL;
+}
+
+#ifdef DMA_BUF_IOCTL_SYNC
+static void dmabuf_sync(const struct dmabuf_view *v, uint64_t flags)
+{
+    struct dma_buf_sync sync;
+
+    sync.flags = flags | DMA_BUF_SYNC_READ;
+    while (ioctl(v->fd, DMA_BUF_IOCTL_SYNC, &sync) && errno == EINTR)
+        ;
+}
+#endif
+
+void dmabuf_begin_read(const struct dmabuf_view *v)
+{
+#ifdef DMA_BUF_IOCTL_SYNC
+    dmabuf_sync(v, DMA_BUF_SYNC_START);
+#endif
+}
+
+void dmabuf_end_read(const struct dmabuf_view *v)
+{
+#ifdef DMA_BUF_IOCTL_SYNC
+    dmabuf_sync(v, DMA_BUF_SYNC_END);
+#endif
+}
@@ -0,0 +1,55 @@
+#ifndef DMABUF_SHARE_H
+#define DMABUF_SHARE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Handing exported V4L2 capture buffers (dma-buf fds) to consumers.
+ *
+ * Out-of-process protocol over a SOCK_SEQPACKET unix socket:
+ *   server -> client  dmabuf_hello, all buffer fds attached (SCM_RIGHTS)
+ *   server -> client  dmabuf_frame_msg per filled buffer
+ *   client -> server  dmabuf_frame_msg echoed back once the buffer is free
+ * Frame data itself never crosses the socket.
+ */
+
+#define DMABUF_MAX_BUFFERS 32
+
+struct dmabuf_hello {
+    uint32_t    count;
+    uint32_t    length;
+    uint32_t    width;
+    uint32_t    height;
+    uint32_t    bytesperline;
+    uint32_t    pixelformat;
+};
+
+struct dmabuf_frame_msg {
+    uint32_t    index;
+    uint32_t    bytesused;
+    uint32_t    sequence;
+    uint32_t    reserved;
+    uint64_t    timestamp_ns;
+};
+
+struct dmabuf_view {
+    int         fd;
+    void *      addr;
+    size_t      length;
+};
+
+int dmabuf_listen(const char *path);
+int dmabuf_connect(const char *path);
+int dmabuf_send_fds(int sock, const void *msg, size_t len, const int *fds, int nfds);
+/* returns the number of fds received, or -errno */
+int dmabuf_recv_fds(int sock, void *msg, size_t len, int *fds, int max_fds);
+
+/* read-only mapping of a dma-buf; the view owns neither fd nor buffer */
+int dmabuf_view_map(struct dmabuf_view *v, int fd, size_t length);
+void dmabuf_view_unmap(struct dmabuf_view *v);
+/* bracket CPU reads so non-coherent importers see the device's writes */
+void dmabuf_begin_read(const struct dmabuf_view *v);
+void dmabuf_end_read(const struct dmabuf_view *v);
+
+#endif
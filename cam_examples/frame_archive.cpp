@@ -0,0 +1,372 @@
+#include "frame_archive.h"
+
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace std;
+
+/* write through a bounce buffer of this size when the source is unaligned */
+#define ARCHIVE_CHUNK (1U << 20)
+
+struct frame_archive {
+    int                     fd;
+    bool                    direct;
+    uint64_t                offset;
+    uint64_t                allocated;
+    uint64_t                grow;
+    void *                  bounce;
+    vector<archive_entry>   index;
+    /* side index: entries [0, synced) are in it */
+    int                     idx_fd;
+    size_t                  synced;
+    string                  idx_path;
+};
+
+struct frame_archive_reader {
+    int                     fd;
+    const uint8_t *         base;
+    size_t                  size;
+    const archive_entry *   index;
+    uint64_t                count;
+    /* the side index of an unclosed archive */
+    vector<archive_entry>   recovered;
+};
+
+static uint64_t align_up(uint64_t v)
+{
+    return (v + ARCHIVE_ALIGN - 1) & ~(uint64_t)(ARCHIVE_ALIGN - 1);
+}
+
+static int write_full(int fd, const void *data, size_t len, uint64_t off)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    ssize_t ret;
+
+    while (len) {
+        ret = pwrite(fd, p, len, off);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            return -errno;
+        }
+        p += ret;
+        off += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+static int reserve(struct frame_archive *ar, uint64_t end)
+{
+    uint64_t want;
+    int ret;
+
+    if (end <= ar->allocated)
+        return 0;
+
+    want = ar->allocated + ar->grow;
+    if (want < end)
+        want = align_up(end);
+    ret = fallocate(ar->fd, 0, ar->allocated, want - ar->allocated);
+    if (ret && errno != EOPNOTSUPP)
+        return -errno;
+    /* without fallocate the file simply grows with the writes */
+    ar->allocated = want;
+    return 0;
+}
+
+/* the header of an archive still being written: index_offset 0 */
+static int write_header(struct frame_archive *ar, uint64_t index_offset,
+        uint64_t frame_count)
+{
+    struct archive_header *hdr = (struct archive_header *)ar->bounce;
+
+    memset(hdr, 0, ARCHIVE_ALIGN);
+    memcpy(hdr->magic, ARCHIVE_MAGIC, sizeof(hdr->magic));
+    hdr->version = ARCHIVE_VERSION;
+    hdr->align = ARCHIVE_ALIGN;
+    hdr->index_offset = index_offset;
+    hdr->frame_count = frame_count;
+    return write_full(ar->fd, hdr, ARCHIVE_ALIGN, 0);
+}
+
+/*
+ * Frames first, then their entries: the side index never lists a frame
+ * that could still be lost.
+ */
+static int sync_index(struct frame_archive *ar)
+{
+    size_t n = ar->index.size() - ar->synced;
+    int ret;
+
+    if (!n || ar->idx_fd < 0)
+        return 0;
+    if (fdatasync(ar->fd))
+        return -errno;
+    ret = write_full(ar->idx_fd, &ar->index[ar->synced],
+            n * sizeof(struct archive_entry),
+            ar->synced * sizeof(struct archive_entry));
+    if (ret)
+        return ret;
+    if (fdatasync(ar->idx_fd))
+        return -errno;
+    ar->synced += n;
+    return 0;
+}
+
+struct frame_archive *archive_create(const char *path, size_t frame_size,
+        unsigned long prealloc_frames, bool direct)
+{
+    struct frame_archive *ar;
+    int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+
+    ar = new frame_archive;
+    ar->direct = false;
+    ar->fd = -1;
+    if (direct) {
+        ar->fd = open(path, flags | O_DIRECT, 0644);
+        ar->direct = ar->fd >= 0;
+    }
+    if (ar->fd < 0)
+        ar->fd = open(path, flags, 0644);
+    if (ar->fd < 0) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+        delete ar;
+        return NULL;
+    }
+
+    if (posix_memalign(&ar->bounce, ARCHIVE_ALIGN, ARCHIVE_CHUNK)) {
+        close(ar->fd);
+        delete ar;
+        return NULL;
+    }
+
+    ar->synced = 0;
+    ar->idx_path = string(path) + ARCHIVE_INDEX_SUFFIX;
+    ar->idx_fd = open(ar->idx_path.c_str(),
+            O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (ar->idx_fd < 0)
+        printf("[%s]%d, no side index %s, a crash loses the recording: %s\n",
+                __func__, __LINE__, ar->idx_path.c_str(), strerror(errno));
+    if (write_header(ar, 0, 0))
+        printf("[%s]%d, writing the header of %s failed\n", __func__, __LINE__, path);
+
+    if (!prealloc_frames)
+        prealloc_frames = 64;
+    ar->offset = ARCHIVE_ALIGN;
+    ar->allocated = 0;
+    ar->grow = align_up(frame_size) * prealloc_frames;
+    if (reserve(ar, ARCHIVE_ALIGN + ar->grow))
+        printf("[%s]%d, preallocating %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+
+    return ar;
+}
+
+/*
+ * Aligned whole blocks are written straight from the caller's buffer when
+ * it is page aligned (V4L2 mmap buffers are); everything else, including
+ * the zero padded tail, goes through the bounce buffer.
+ */
+static int write_aligned(struct frame_archive *ar, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t off = ar->offset;
+    size_t body = len & ~(size_t)(ARCHIVE_ALIGN - 1);
+    size_t n;
+    int ret;
+
+    if (((uintptr_t)p & (ARCHIVE_ALIGN - 1)) == 0 && body) {
+        ret = write_full(ar->fd, p, body, off);
+        /* O_DIRECT cannot pin some driver mappings; bounce those instead */
+        if (ret && !(ar->direct && (ret == -EFAULT || ret == -EINVAL)))
+            return ret;
+        if (!ret) {
+            p += body;
+            off += body;
+            len -= body;
+        }
+    }
+
+    while (len) {
+        n = len < ARCHIVE_CHUNK ? len : ARCHIVE_CHUNK;
+        memcpy(ar->bounce, p, n);
+        if (n & (ARCHIVE_ALIGN - 1))
+            memset((uint8_t *)ar->bounce + n, 0, align_up(n) - n);
+        ret = write_full(ar->fd, ar->bounce, align_up(n), off);
+        if (ret)
+            return ret;
+        p += n;
+        off += align_up(n);
+        len -= n;
+    }
+
+    ar->offset = off;
+    return 0;
+}
+
+int archive_append(struct frame_archive *ar, const void *data, size_t len,
+        const struct archive_frame_info *info)
+{
+    struct archive_entry e;
+    int ret;
+
+    ret = reserve(ar, ar->offset + align_up(len));
+    if (ret)
+        return ret;
+
+    e.offset = ar->offset;
+    e.timestamp_ns = info->timestamp_ns;
+    e.sequence = info->sequence;
+    e.bytesused = len;
+    e.pixelformat = info->pixelformat;
+    e.width = info->width;
+    e.height = info->height;
+
+    ret = write_aligned(ar, data, len);
+    if (ret)
+        return ret;
+
+    ar->index.push_back(e);
+    if (ar->index.size() - ar->synced >= ARCHIVE_SYNC_FRAMES)
+        return sync_index(ar);
+    return 0;
+}
+
+int archive_close(struct frame_archive *ar)
+{
+    uint64_t index_offset = ar->offset;
+    int ret;
+
+    ret = write_aligned(ar, ar->index.data(),
+            ar->index.size() * sizeof(struct archive_entry));
+
+    if (!ret)
+        ret = write_header(ar, index_offset, ar->index.size());
+
+    if (!ret && ftruncate(ar->fd, ar->offset))
+        ret = -errno;
+    if (!ret && fdatasync(ar->fd))
+        ret = -errno;
+
+    /* a failed close leaves the side index for archive_open() */
+    if (ar->idx_fd >= 0) {
+        if (ret)
+            sync_index(ar);
+        close(ar->idx_fd);
+        if (!ret)
+            unlink(ar->idx_path.c_str());
+    }
+    close(ar->fd);
+    free(ar->bounce);
+    delete ar;
+    return ret;
+}
+
+/*
+ * Entries of the side index of an unclosed archive, up to the first one
+ * whose frame is not (completely) in the file.
+ */
+static void recover_index(struct frame_archive_reader *rd, const char *path)
+{
+    string idx_path = string(path) + ARCHIVE_INDEX_SUFFIX;
+    struct archive_entry e;
+    int fd;
+
+    fd = open(idx_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    while (read(fd, &e, sizeof(e)) == (ssize_t)sizeof(e)) {
+        if ((e.offset & (ARCHIVE_ALIGN - 1)) || e.offset < ARCHIVE_ALIGN ||
+                e.offset > rd->size || e.bytesused > rd->size - e.offset)
+            break;
+        rd->recovered.push_back(e);
+    }
+    close(fd);
+}
+
+struct frame_archive_reader *archive_open(const char *path)
+{
+    struct frame_archive_reader *rd;
+    const struct archive_header *hdr;
+    struct stat st;
+    void *base;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) || (size_t)st.st_size < ARCHIVE_ALIGN) {
+        close(fd);
+        return NULL;
+    }
+
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    hdr = (const struct archive_header *)base;
+    if (memcmp(hdr->magic, ARCHIVE_MAGIC, sizeof(hdr->magic)) ||
+            hdr->version != ARCHIVE_VERSION ||
+            hdr->index_offset > (uint64_t)st.st_size ||
+            hdr->frame_count > ((uint64_t)st.st_size - hdr->index_offset) /
+            sizeof(struct archive_entry)) {
+        printf("[%s]%d, %s is not a complete frame archive\n", __func__, __LINE__, path);
+        munmap(base, st.st_size);
+        close(fd);
+        return NULL;
+    }
+
+    rd = new frame_archive_reader;
+    rd->fd = fd;
+    rd->base = (const uint8_t *)base;
+    rd->size = st.st_size;
+    if (hdr->index_offset) {
+        rd->index = (const struct archive_entry *)(rd->base + hdr->index_offset);
+        rd->count = hdr->frame_count;
+        return rd;
+    }
+
+    recover_index(rd, path);
+    printf("[%s]%d, %s was not closed, %zu frames recovered from its side index\n",
+            __func__, __LINE__, path, rd->recovered.size());
+    rd->index = rd->recovered.data();
+    rd->count = rd->recovered.size();
+    return rd;
+}
+
+uint64_t archive_frame_count(const struct frame_archive_reader *rd)
+{
+    return rd->count;
+}
+
+const void *archive_frame(const struct frame_archive_reader *rd, uint64_t i,
+        struct archive_entry *entry)
+{
+    const struct archive_entry *e;
+
+    if (i >= rd->count)
+        return NULL;
+    e = &rd->index[i];
+    if (e->offset > rd->size || e->bytesused > rd->size - e->offset)
+        return NULL;
+    if (entry)
+        *entry = *e;
+    return rd->base + e->offset;
+}
+
+void archive_release(struct frame_archive_reader *rd)
+{
+    munmap((void *)rd->base, rd->size);
+    close(rd->fd);
+    delete rd;
+}
@@ -0,0 +1,80 @@
+#ifndef FRAME_ARCHIVE_H
+#define FRAME_ARCHIVE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Single-file raw frame archive.
+ *
+ * Layout: a 4 KiB header, then every frame starting on a 4 KiB boundary
+ * and padded up to the next one, then the index (one archive_entry per
+ * frame), also 4 KiB aligned. The header is rewritten on close with the
+ * index location and frame count. All fields are little endian.
+ *
+ * While recording, the header has index_offset 0 and the entries also go
+ * to a side index, <path>.idx, every ARCHIVE_SYNC_FRAMES frames, after
+ * the frames themselves are synced. archive_open() falls back to it for
+ * an archive that was never closed, so a crash or power loss costs at
+ * most the frames since the last sync. archive_close() removes it.
+ */
+
+#define ARCHIVE_MAGIC       "YUVARCH1"
+#define ARCHIVE_VERSION     1
+#define ARCHIVE_ALIGN       4096U
+#define ARCHIVE_SYNC_FRAMES 30U
+#define ARCHIVE_INDEX_SUFFIX ".idx"
+
+struct archive_header {
+    char        magic[8];
+    uint32_t    version;
+    uint32_t    align;
+    uint64_t    index_offset;
+    uint64_t    frame_count;
+};
+
+struct archive_entry {
+    uint64_t    offset;
+    uint64_t    timestamp_ns;
+    uint32_t    sequence;
+    uint32_t    bytesused;
+    uint32_t    pixelformat;
+    uint16_t    width;
+    uint16_t    height;
+};
+
+struct archive_frame_info {
+    uint32_t    sequence;
+    uint64_t    timestamp_ns;
+    uint32_t    pixelformat;
+    uint16_t    width;
+    uint16_t    height;
+};
+
+struct frame_archive;
+struct frame_archive_reader;
+
+/*
+ * Create path and preallocate room for prealloc_frames frames of
+ * frame_size bytes; the file grows by the same amount whenever it fills.
+ * direct asks for O_DIRECT, silently dropped where unsupported.
+ */
+struct frame_archive *archive_create(const char *path, size_t frame_size,
+        unsigned long prealloc_frames, bool direct);
+int archive_append(struct frame_archive *ar, const void *data, size_t len,
+        const struct archive_frame_info *info);
+/*
+ * writes the index and header, trims the preallocation, removes the side
+ * index and frees ar
+ */
+int archive_close(struct frame_archive *ar);
+
+/* a closed archive, or the frames of an unclosed one its side index lists */
+struct frame_archive_reader *archive_open(const char *path);
+uint64_t archive_frame_count(const struct frame_archive_reader *rd);
+/* O(1): returns the frame data and fills *entry, NULL if i is out of range */
+const void *archive_frame(const struct frame_archive_reader *rd, uint64_t i,
+        struct archive_entry *entry);
+void archive_release(struct frame_archive_reader *rd);
+
+#endif
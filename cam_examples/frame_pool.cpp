@@ -0,0 +1,129 @@
+#include "frame_pool.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+struct frame_pool {
+    unsigned char *         base;
+    size_t                  map_len;
+    size_t                  frame_size;
+    unsigned int            count;
+    enum frame_pool_backing backing;
+};
+
+static size_t round_up(size_t v, size_t align)
+{
+    return (v + align - 1) & ~(align - 1);
+}
+
+/*
+ * THP needs 2 MiB aligned virtual ranges, so over-map by one huge page and
+ * trim the unaligned head and tail.
+ */
+static unsigned char *map_thp(size_t len, size_t *map_len)
+{
+    unsigned char *p, *aligned;
+    size_t want = len + FRAME_POOL_HUGE_SIZE;
+    size_t head;
+
+    p = (unsigned char *)mmap(NULL, want, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        return NULL;
+
+    aligned = (unsigned char *)round_up((uintptr_t)p, FRAME_POOL_HUGE_SIZE);
+    head = aligned - p;
+    if (head)
+        munmap(p, head);
+    if (want - head > len)
+        munmap(aligned + len, want - head - len);
+
+    *map_len = len;
+    return aligned;
+}
+
+struct frame_pool *frame_pool_create(size_t frame_size, unsigned int count)
+{
+    struct frame_pool *pool;
+    size_t len;
+    void *p;
+
+    if (!frame_size || !count)
+        return NULL;
+
+    pool = new frame_pool;
+    pool->frame_size = round_up(frame_size, sysconf(_SC_PAGESIZE));
+    pool->count = count;
+    len = round_up(pool->frame_size * count, FRAME_POOL_HUGE_SIZE);
+
+    p = mmap(NULL, len, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+    if (p != MAP_FAILED) {
+        pool->base = (unsigned char *)p;
+        pool->map_len = len;
+        pool->backing = POOL_HUGETLB;
+        return pool;
+    }
+
+    pool->base = map_thp(len, &pool->map_len);
+    if (!pool->base) {
+        printf("[%s]%d, mmap %zu bytes failed: %s\n", __func__, __LINE__, len, strerror(errno));
+        delete pool;
+        return NULL;
+    }
+
+    pool->backing = POOL_SMALL;
+#ifdef MADV_HUGEPAGE
+    if (!madvise(pool->base, pool->map_len, MADV_HUGEPAGE))
+        pool->backing = POOL_THP;
+#endif
+    /* fault everything in now rather than in the middle of a capture */
+    memset(pool->base, 0, pool->map_len);
+    return pool;
+}
+
+void frame_pool_destroy(struct frame_pool *pool)
+{
+    if (!pool)
+        return;
+    munmap(pool->base, pool->map_len);
+    delete pool;
+}
+
+void *frame_pool_frame(const struct frame_pool *pool, unsigned int i)
+{
+    if (i >= pool->count)
+        return NULL;
+    return pool->base + (size_t)i * pool->frame_size;
+}
+
+unsigned int frame_pool_count(const struct frame_pool *pool)
+{
+    return pool->count;
+}
+
+size_t frame_pool_frame_size(const struct frame_pool *pool)
+{
+    return pool->frame_size;
+}
+
+enum frame_pool_backing frame_pool_backing(const struct frame_pool *pool)
+{
+    return pool->backing;
+}
+
+const char *frame_pool_backing_name(enum frame_pool_backing backing)
+{
+    switch (backing) {
+    case POOL_HUGETLB:
+        return "hugetlb";
+    case POOL_THP:
+        return "transparent huge pages";
+    default:
+        return "4 KiB pages";
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef FRAME_POOL_H
+#define FRAME_POOL_H
+
+#include <stddef.h>
+
+/*
+ * Fixed set of equally sized, page aligned frame buffers carved from one
+ * anonymous region. The region is backed by huge pages when possible so
+ * stages that sweep whole frames (capture, demux, conversion, encoding)
+ * take a TLB miss per 2 MiB instead of per 4 KiB.
+ */
+
+#define FRAME_POOL_HUGE_SIZE    (2UL << 20)
+
+enum frame_pool_backing {
+    POOL_HUGETLB,       /* MAP_HUGETLB, reserved hugetlbfs pages */
+    POOL_THP,           /* transparent huge pages requested with madvise */
+    POOL_SMALL,         /* plain 4 KiB pages */
+};
+
+struct frame_pool;
+
+struct frame_pool *frame_pool_create(size_t frame_size, unsigned int count);
+void frame_pool_destroy(struct frame_pool *pool);
+
+void *frame_pool_frame(const struct frame_pool *pool, unsigned int i);
+unsigned int frame_pool_count(const struct frame_pool *pool);
+/* frame_size rounded up to whole pages: the stride between frames */
+size_t frame_pool_frame_size(const struct frame_pool *pool);
+enum frame_pool_backing frame_pool_backing(const struct frame_pool *pool);
+const char *frame_pool_backing_name(enum frame_pool_backing backing);
+
+#endif
@@ -0,0 +1,626 @@
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef HAVE_LIBJPEG
+extern "C" {
+#include <jpeglib.h>
+}
+#endif
+
+#include "mjpeg_preview.h"
+
+using namespace std;
+
+/* keeps at most about one frame queued in the kernel per client */
+#define PREVIEW_SNDBUF (64 * 1024)
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#ifdef HAVE_LIBJPEG
+
+/* libjpeg destination writing into a growable buffer that survives frames */
+struct jpeg_sink {
+    struct jpeg_destination_mgr pub;
+    vector<uint8_t>             buf;
+    size_t                      len;
+};
+
+struct stripe {
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr       jerr;
+    struct jpeg_sink            sink;
+    unsigned int                row0;
+    unsigned int                rows;
+    /* one 8-line band of each plane, the unit jpeg_write_raw_data takes */
+    vector<uint8_t>             plane[3];
+    JSAMPROW                    band[3][DCTSIZE];
+};
+
+struct mjpeg_encoder {
+    unsigned int                width;
+    unsigned int                height;
+    unsigned int                padded_width;
+    vector<stripe *>            stripes;
+    uint8_t                     ylut[256];
+    uint8_t                     clut[256];
+    const uint8_t *             src;
+    size_t                      stride;
+    vector<uint8_t>             frame;
+    mutex                       lock;
+    condition_variable          work_cv;
+    condition_variable          done_cv;
+    vector<thread>              workers;
+    unsigned long               generation;
+    unsigned int                pending;
+    bool                        quit;
+};
+
+static void sink_init(j_compress_ptr cinfo)
+{
+    struct jpeg_sink *s = (struct jpeg_sink *)cinfo->dest;
+
+    s->pub.next_output_byte = s->buf.data();
+    s->pub.free_in_buffer = s->buf.size();
+}
+
+static boolean sink_grow(j_compress_ptr cinfo)
+{
+    struct jpeg_sink *s = (struct jpeg_sink *)cinfo->dest;
+    size_t used = s->buf.size();
+
+    /* called with the buffer full; growth is rare once warmed up */
+    s->buf.resize(used * 2);
+    s->pub.next_output_byte = s->buf.data() + used;
+    s->pub.free_in_buffer = s->buf.size() - used;
+    return TRUE;
+}
+
+static void sink_term(j_compress_ptr cinfo)
+{
+    struct jpeg_sink *s = (struct jpeg_sink *)cinfo->dest;
+
+    s->len = s->buf.size() - s->pub.free_in_buffer;
+}
+
+/*
+ * YUYV rows row..row+7 into the Y/Cb/Cr bands, stretched from the camera's
+ * limited range to the full range JFIF decoders assume. Rows past the
+ * bottom and columns past the right edge repeat the last ones.
+ */
+static void fill_band(const struct mjpeg_encoder *enc, struct stripe *s, unsigned int row)
+{
+    unsigned int r, x, w2 = enc->width / 2, pw2 = enc->padded_width / 2;
+    const uint8_t *src;
+    uint8_t *y, *cb, *cr;
+
+    for (r = 0; r < DCTSIZE; r++) {
+        src = enc->src + min(row + r, enc->height - 1) * enc->stride;
+        y = s->band[0][r];
+        cb = s->band[1][r];
+        cr = s->band[2][r];
+        for (x = 0; x < w2; x++, src += 4) {
+            y[2 * x] = enc->ylut[src[0]];
+            cb[x] = enc->clut[src[1]];
+            y[2 * x + 1] = enc->ylut[src[2]];
+            cr[x] = enc->clut[src[3]];
+        }
+        for (; x < pw2; x++) {
+            y[2 * x] = y[2 * x + 1] = y[2 * w2 - 1];
+            cb[x] = cb[w2 - 1];
+            cr[x] = cr[w2 - 1];
+        }
+    }
+}
+
+static void encode_stripe(struct mjpeg_encoder *enc, struct stripe *s)
+{
+    JSAMPARRAY planes[3] = { s->band[0], s->band[1], s->band[2] };
+    unsigned int y;
+
+    jpeg_start_compress(&s->cinfo, TRUE);
+    for (y = 0; y < s->rows; y += DCTSIZE) {
+        fill_band(enc, s, s->row0 + y);
+        jpeg_write_raw_data(&s->cinfo, planes, DCTSIZE);
+    }
+    jpeg_finish_compress(&s->cinfo);
+}
+
+static void stripe_worker(struct mjpeg_encoder *enc, unsigned int id)
+{
+    unsigned long seen = 0;
+
+    for (;;) {
+        {
+            unique_lock<mutex> l(enc->lock);
+
+            enc->work_cv.wait(l, [&] { return enc->quit || enc->generation != seen; });
+            if (enc->quit)
+                return;
+            seen = enc->generation;
+        }
+        encode_stripe(enc, enc->stripes[id]);
+        {
+            lock_guard<mutex> l(enc->lock);
+
+            if (--enc->pending == 0)
+                enc->done_cv.notify_one();
+        }
+    }
+}
+
+/* offsets of the SOF0 segment and of the first entropy coded byte */
+static int find_scan(const vector<uint8_t> &jpg, size_t len, size_t *sof, size_t *scan)
+{
+    size_t i = 2;
+    unsigned int seg;
+
+    while (i + 4 <= len && jpg[i] == 0xff) {
+        seg = jpg[i + 2] << 8 | jpg[i + 3];
+        if (jpg[i + 1] == 0xc0)
+            *sof = i;
+        if (jpg[i + 1] == 0xda) {
+            *scan = i + 2 + seg;
+            return *scan + 2 <= len ? 0 : -1;
+        }
+        i += 2 + seg;
+    }
+    return -1;
+}
+
+struct mjpeg_encoder *mjpeg_encoder_create(unsigned int width, unsigned int height,
+        int quality, unsigned int stripes)
+{
+    struct mjpeg_encoder *enc;
+    struct stripe *s;
+    unsigned int i, j, r, rows, mcus;
+    int v;
+
+    if (!width || !height || width % 2) {
+        printf("[%s]%d, cannot encode %ux%u\n", __func__, __LINE__, width, height);
+        return NULL;
+    }
+
+    enc = new mjpeg_encoder;
+    enc->width = width;
+    enc->height = height;
+    /* 4:2:2 MCUs are 16x8 */
+    enc->padded_width = (width + 15) & ~15U;
+    enc->generation = 0;
+    enc->pending = 0;
+    enc->quit = false;
+    for (i = 0; i < 256; i++) {
+        v = ((int)i - 16) * 255 / 219;
+        enc->ylut[i] = v < 0 ? 0 : v > 255 ? 255 : v;
+        v = ((int)i - 128) * 255 / 224 + 128;
+        enc->clut[i] = v < 0 ? 0 : v > 255 ? 255 : v;
+    }
+
+    /*
+     * Every stripe but the last is a whole number of MCU rows, so it maps
+     * onto exactly one restart interval of the full image.
+     */
+    if (!stripes)
+        stripes = 1;
+    rows = ((height + stripes - 1) / stripes + DCTSIZE - 1) & ~(DCTSIZE - 1);
+    mcus = enc->padded_width / 16 * (rows / DCTSIZE);
+    if (mcus > 65535) {
+        rows = height;
+        mcus = 0;
+    }
+    if (rows >= height)
+        mcus = 0;
+
+    for (r = 0; r < height; r += rows) {
+        s = new stripe;
+        s->row0 = r;
+        s->rows = min(rows, height - r);
+        s->plane[0].resize(enc->padded_width * DCTSIZE);
+        s->plane[1].resize(enc->padded_width / 2 * DCTSIZE);
+        s->plane[2].resize(enc->padded_width / 2 * DCTSIZE);
+        for (i = 0; i < 3; i++)
+            for (j = 0; j < DCTSIZE; j++)
+                s->band[i][j] = s->plane[i].data() + j * s->plane[i].size() / DCTSIZE;
+
+        s->cinfo.err = jpeg_std_error(&s->jerr);
+        jpeg_create_compress(&s->cinfo);
+        s->sink.pub.init_destination = sink_init;
+        s->sink.pub.empty_output_buffer = sink_grow;
+        s->sink.pub.term_destination = sink_term;
+        s->sink.buf.resize(enc->padded_width * s->rows / 2 + 4096);
+        s->sink.len = 0;
+        s->cinfo.dest = &s->sink.pub;
+
+        s->cinfo.image_width = width;
+        s->cinfo.image_height = s->rows;
+        s->cinfo.input_components = 3;
+        s->cinfo.in_color_space = JCS_YCbCr;
+        jpeg_set_defaults(&s->cinfo);
+        jpeg_set_quality(&s->cinfo, quality, TRUE);
+        s->cinfo.raw_data_in = TRUE;
+        s->cinfo.comp_info[0].h_samp_factor = 2;
+        s->cinfo.comp_info[0].v_samp_factor = 1;
+        for (i = 1; i < 3; i++) {
+            s->cinfo.comp_info[i].h_samp_factor = 1;
+            s->cinfo.comp_info[i].v_samp_factor = 1;
+        }
+        /* the fast integer DCT is plenty for a preview */
+        s->cinfo.dct_method = JDCT_IFAST;
+        s->cinfo.restart_interval = mcus;
+        enc->stripes.push_back(s);
+    }
+
+    /* the calling thread encodes stripe 0 itself */
+    for (i = 1; i < enc->stripes.size(); i++)
+        enc->workers.push_back(thread(stripe_worker, enc, i));
+    return enc;
+}
+
+void mjpeg_encoder_destroy(struct mjpeg_encoder *enc)
+{
+    size_t i;
+
+    if (!enc)
+        return;
+    {
+        lock_guard<mutex> l(enc->lock);
+
+        enc->quit = true;
+    }
+    enc->work_cv.notify_all();
+    for (i = 0; i < enc->workers.size(); i++)
+        enc->workers[i].join();
+    for (i = 0; i < enc->stripes.size(); i++) {
+        jpeg_destroy_compress(&enc->stripes[i]->cinfo);
+        delete enc->stripes[i];
+    }
+    delete enc;
+}
+
+/*
+ * Stripe 0 supplies the headers (with SOF0 patched to the full height and
+ * its DRI covering one stripe); the entropy data of every further stripe
+ * follows an RSTn marker, which also resets the DC predictors the way
+ * starting a fresh encode did.
+ */
+int mjpeg_encode(struct mjpeg_encoder *enc, const void *yuyv, size_t stride,
+        const uint8_t **jpeg, size_t *len)
+{
+    struct jpeg_sink *k;
+    size_t sof = 0, scan, i;
+
+    enc->src = (const uint8_t *)yuyv;
+    enc->stride = stride;
+
+    if (enc->stripes.size() == 1) {
+        encode_stripe(enc, enc->stripes[0]);
+        *jpeg = enc->stripes[0]->sink.buf.data();
+        *len = enc->stripes[0]->sink.len;
+        return 0;
+    }
+
+    {
+        lock_guard<mutex> l(enc->lock);
+
+        enc->pending = enc->stripes.size() - 1;
+        enc->generation++;
+    }
+    enc->work_cv.notify_all();
+
+    encode_stripe(enc, enc->stripes[0]);
+    {
+        unique_lock<mutex> l(enc->lock);
+
+        enc->done_cv.wait(l, [&] { return enc->pending == 0; });
+    }
+
+    k = &enc->stripes[0]->sink;
+    if (find_scan(k->buf, k->len, &sof, &scan) || !sof)
+        return -EPROTO;
+    enc->frame.assign(k->buf.begin(), k->buf.begin() + k->len - 2);
+    enc->frame[sof + 5] = enc->height >> 8;
+    enc->frame[sof + 6] = enc->height & 0xff;
+
+    for (i = 1; i < enc->stripes.size(); i++) {
+        k = &enc->stripes[i]->sink;
+        if (find_scan(k->buf, k->len, &sof, &scan))
+            return -EPROTO;
+        enc->frame.push_back(0xff);
+        enc->frame.push_back(0xd0 + ((i - 1) & 7));
+        enc->frame.insert(enc->frame.end(), k->buf.begin() + scan, k->buf.begin() + k->len - 2);
+    }
+    enc->frame.push_back(0xff);
+    enc->frame.push_back(0xd9);
+
+    *jpeg = enc->frame.data();
+    *len = enc->frame.size();
+    return 0;
+}
+
+#else
+
+struct mjpeg_encoder *mjpeg_encoder_create(unsigned int width, unsigned int height,
+        int quality, unsigned int stripes)
+{
+    printf("[%s]%d, built without libjpeg (-DHAVE_LIBJPEG -ljpeg)\n", __func__, __LINE__);
+    return NULL;
+}
+
+void mjpeg_encoder_destroy(struct mjpeg_encoder *enc)
+{
+}
+
+int mjpeg_encode(struct mjpeg_encoder *enc, const void *yuyv, size_t stride,
+        const uint8_t **jpeg, size_t *len)
+{
+    return -ENOTSUP;
+}
+
+#endif
+
+struct preview_client {
+    int                         sock;
+    char                        peer[INET_ADDRSTRLEN + 8];
+    thread                      sender;
+    unsigned long               sent;
+    unsigned long               skipped;
+    bool                        done;
+};
+
+/*
+ * One published frame at a time: publishing replaces it, and each client's
+ * sender thread picks up whatever is newest once its previous send is done.
+ */
+struct preview_server {
+    int                         lsock;
+    thread                      acceptor;
+    mutex                       lock;
+    condition_variable          cv;
+    vector<preview_client *>    clients;
+    shared_ptr<vector<uint8_t> > frame;
+    unsigned long long          capture_ns;
+    unsigned long               seq;
+    bool                        quit;
+    /* capture to socket latency of every frame sent, in us */
+    vector<unsigned int>        latency_us;
+    unsigned long               served;
+};
+
+static int send_all(int sock, const uint8_t *p, size_t len)
+{
+    ssize_t n;
+
+    while (len) {
+        n = send(sock, p, len, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -errno;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static void client_main(struct preview_server *srv, struct preview_client *c)
+{
+    shared_ptr<vector<uint8_t> > frame;
+    unsigned long long capture_ns;
+    unsigned long seen = 0;
+    int ret;
+
+    for (;;) {
+        {
+            unique_lock<mutex> l(srv->lock);
+
+            srv->cv.wait(l, [&] { return srv->quit || srv->seq != seen; });
+            if (srv->quit)
+                break;
+            if (seen)
+                c->skipped += srv->seq - seen - 1;
+            seen = srv->seq;
+            frame = srv->frame;
+            capture_ns = srv->capture_ns;
+        }
+
+        ret = send_all(c->sock, frame->data(), frame->size());
+        if (ret) {
+            printf("[%s]%d, %s: %s, dropping client\n", __func__, __LINE__, c->peer, strerror(-ret));
+            break;
+        }
+        c->sent++;
+
+        lock_guard<mutex> l(srv->lock);
+        srv->latency_us.push_back((now_ns() - capture_ns) / 1000);
+    }
+
+    lock_guard<mutex> l(srv->lock);
+    c->done = true;
+}
+
+static void print_client(const struct preview_client *c)
+{
+    printf("preview client %s: %lu frames sent, %lu stale frames skipped\n",
+            c->peer, c->sent, c->skipped);
+}
+
+/* clients that hung up are joined when the next one connects */
+static void reap_clients(struct preview_server *srv)
+{
+    vector<preview_client *> gone;
+    size_t i;
+
+    {
+        lock_guard<mutex> l(srv->lock);
+
+        for (i = 0; i < srv->clients.size(); ) {
+            if (srv->clients[i]->done) {
+                gone.push_back(srv->clients[i]);
+                srv->clients.erase(srv->clients.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+    for (i = 0; i < gone.size(); i++) {
+        gone[i]->sender.join();
+        close(gone[i]->sock);
+        print_client(gone[i]);
+        delete gone[i];
+    }
+}
+
+static void accept_main(struct preview_server *srv)
+{
+    struct preview_client *c;
+    struct sockaddr_in addr;
+    socklen_t alen;
+    int sock, one = 1, sndbuf = PREVIEW_SNDBUF;
+
+    for (;;) {
+        alen = sizeof(addr);
+        sock = accept4(srv->lsock, (struct sockaddr *)&addr, &alen, SOCK_CLOEXEC);
+        if (sock < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            /* preview_stop shuts the listening socket down */
+            return;
+        }
+        reap_clients(srv);
+
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+        c = new preview_client;
+        c->sock = sock;
+        c->sent = 0;
+        c->skipped = 0;
+        c->done = false;
+        inet_ntop(AF_INET, &addr.sin_addr, c->peer, sizeof(c->peer));
+        snprintf(c->peer + strlen(c->peer), sizeof(c->peer) - strlen(c->peer), ":%u",
+                ntohs(addr.sin_port));
+        printf("preview client %s connected\n", c->peer);
+
+        lock_guard<mutex> l(srv->lock);
+        if (srv->quit) {
+            close(sock);
+            delete c;
+            return;
+        }
+        srv->served++;
+        srv->clients.push_back(c);
+        c->sender = thread(client_main, srv, c);
+    }
+}
+
+struct preview_server *preview_start(unsigned short port)
+{
+    struct preview_server *srv;
+    struct sockaddr_in addr;
+    int one = 1;
+
+    srv = new preview_server;
+    srv->lsock = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (srv->lsock < 0) {
+        printf("[%s]%d, socket failed: %s\n", __func__, __LINE__, strerror(errno));
+        delete srv;
+        return NULL;
+    }
+    setsockopt(srv->lsock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(srv->lsock, (struct sockaddr *)&addr, sizeof(addr)) || listen(srv->lsock, 4)) {
+        printf("[%s]%d, listen on port %u failed: %s\n", __func__, __LINE__, port, strerror(errno));
+        close(srv->lsock);
+        delete srv;
+        return NULL;
+    }
+
+    srv->capture_ns = 0;
+    srv->seq = 0;
+    srv->quit = false;
+    srv->served = 0;
+    srv->acceptor = thread(accept_main, srv);
+    printf("preview: serving MJPEG on port %u\n", port);
+    return srv;
+}
+
+void preview_publish(struct preview_server *srv, const uint8_t *jpeg, size_t len,
+        uint64_t capture_ns)
+{
+    shared_ptr<vector<uint8_t> > frame = make_shared<vector<uint8_t> >(jpeg, jpeg + len);
+
+    {
+        lock_guard<mutex> l(srv->lock);
+
+        srv->frame = frame;
+        srv->capture_ns = capture_ns;
+        srv->seq++;
+    }
+    srv->cv.notify_all();
+}
+
+void preview_stop(struct preview_server *srv)
+{
+    unsigned long long sum = 0;
+    size_t i;
+
+    if (!srv)
+        return;
+    vector<unsigned int> &lat = srv->latency_us;
+
+    {
+        lock_guard<mutex> l(srv->lock);
+
+        srv->quit = true;
+        /* unblocks accept() and any send() stuck on a slow client */
+        shutdown(srv->lsock, SHUT_RDWR);
+        for (i = 0; i < srv->clients.size(); i++)
+            shutdown(srv->clients[i]->sock, SHUT_RDWR);
+    }
+    srv->cv.notify_all();
+    srv->acceptor.join();
+    close(srv->lsock);
+
+    for (i = 0; i < srv->clients.size(); i++) {
+        srv->clients[i]->sender.join();
+        close(srv->clients[i]->sock);
+        print_client(srv->clients[i]);
+        delete srv->clients[i];
+    }
+
+    printf("preview: %lu frames published, %lu clients served\n", srv->seq, srv->served);
+    if (!lat.empty()) {
+        for (i = 0; i < lat.size(); i++)
+            sum += lat[i];
+        sort(lat.begin(), lat.end());
+        printf("capture->socket latency: avg %.1f ms, p50 %.1f ms, p99 %.1f ms, max %.1f ms over %zu frames\n",
+                sum / 1e3 / lat.size(), lat[lat.size() / 2] / 1e3,
+                lat[lat.size() * 99 / 100] / 1e3, lat.back() / 1e3, lat.size());
+    }
+    delete srv;
+}
@@ -0,0 +1,41 @@
+#ifndef MJPEG_PREVIEW_H
+#define MJPEG_PREVIEW_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Live preview for the gst client started by python/myPython.py
+ * (tcpclientsrc port=8554 ! jpegdec): back to back baseline JPEGs over
+ * TCP, one stream per client.
+ *
+ * The encoder feeds YUYV to libjpeg as raw 4:2:2 YCbCr (no RGB round
+ * trip). With stripes > 1 horizontal bands are encoded on parallel
+ * threads and spliced into one JPEG: every band becomes one restart
+ * interval, separated by RSTn markers.
+ */
+
+#define PREVIEW_PORT 8554
+
+struct mjpeg_encoder;
+struct preview_server;
+
+struct mjpeg_encoder *mjpeg_encoder_create(unsigned int width, unsigned int height,
+        int quality, unsigned int stripes);
+void mjpeg_encoder_destroy(struct mjpeg_encoder *enc);
+/* *jpeg stays valid until the next call */
+int mjpeg_encode(struct mjpeg_encoder *enc, const void *yuyv, size_t stride,
+        const uint8_t **jpeg, size_t *len);
+
+/*
+ * Clients always get the newest published frame; frames published while a
+ * client is still sending are skipped for that client, never queued.
+ */
+struct preview_server *preview_start(unsigned short port);
+/* capture_ns: CLOCK_MONOTONIC capture time, for glass-to-socket latency */
+void preview_publish(struct preview_server *srv, const uint8_t *jpeg, size_t len,
+        uint64_t capture_ns);
+/* disconnects all clients, prints per-client and latency statistics */
+void preview_stop(struct preview_server *srv);
+
+#endif
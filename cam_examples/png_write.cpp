@@ -0,0 +1,113 @@
+#include "png_write.h"
+
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace std;
+
+static uint32_t crc_table[256];
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t len)
+{
+    size_t i;
+    int k;
+
+    if (!crc_table[1]) {
+        for (i = 0; i < 256; i++) {
+            uint32_t c = i;
+
+            for (k = 0; k < 8; k++)
+                c = c & 1 ? 0xedb88320U ^ (c >> 1) : c >> 1;
+            crc_table[i] = c;
+        }
+    }
+    crc = ~crc;
+    for (i = 0; i < len; i++)
+        crc = crc_table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put_be32(vector<uint8_t> &v, uint32_t x)
+{
+    v.push_back(x >> 24);
+    v.push_back(x >> 16);
+    v.push_back(x >> 8);
+    v.push_back(x);
+}
+
+static void put_chunk(FILE *f, const char *type, const vector<uint8_t> &data)
+{
+    vector<uint8_t> hdr;
+    uint32_t crc;
+
+    put_be32(hdr, data.size());
+    hdr.insert(hdr.end(), type, type + 4);
+    crc = crc32_update(0, hdr.data() + 4, 4);
+    crc = crc32_update(crc, data.data(), data.size());
+    fwrite(hdr.data(), 1, hdr.size(), f);
+    fwrite(data.data(), 1, data.size(), f);
+    hdr.clear();
+    put_be32(hdr, crc);
+    fwrite(hdr.data(), 1, 4, f);
+}
+
+int png_write_rgb(const char *path, const uint8_t *rgb, unsigned int w, unsigned int h)
+{
+    vector<uint8_t> ihdr, idat, raw;
+    size_t row = (size_t)w * 3, off, n;
+    uint32_t a = 1, b = 0;
+    unsigned int y;
+    size_t i;
+    FILE *f;
+
+    raw.reserve((row + 1) * h);
+    for (y = 0; y < h; y++) {
+        raw.push_back(0);   /* filter: none */
+        raw.insert(raw.end(), rgb + y * row, rgb + (y + 1) * row);
+    }
+
+    idat.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    idat.push_back(0x78);
+    idat.push_back(0x01);
+    for (off = 0; off < raw.size() || off == 0; off += n) {
+        n = raw.size() - off < 65535 ? raw.size() - off : 65535;
+        idat.push_back(off + n == raw.size());
+        idat.push_back(n & 0xff);
+        idat.push_back(n >> 8);
+        idat.push_back(~n & 0xff);
+        idat.push_back((~n >> 8) & 0xff);
+        idat.insert(idat.end(), raw.begin() + off, raw.begin() + off + n);
+        if (!n)
+            break;
+    }
+    for (i = 0; i < raw.size(); i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_be32(idat, (b << 16) | a);
+
+    put_be32(ihdr, w);
+    put_be32(ihdr, h);
+    ihdr.push_back(8);      /* bit depth */
+    ihdr.push_back(2);      /* truecolour */
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+
+    f = fopen(path, "wb");
+    if (!f) {
+        printf("[%s]%d, open %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+        return -1;
+    }
+    fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+    put_chunk(f, "IHDR", ihdr);
+    put_chunk(f, "IDAT", idat);
+    put_chunk(f, "IEND", vector<uint8_t>());
+    if (fclose(f)) {
+        printf("[%s]%d, write %s failed: %s\n", __func__, __LINE__, path, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
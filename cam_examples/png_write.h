@@ -0,0 +1,14 @@
+#ifndef PNG_WRITE_H
+#define PNG_WRITE_H
+
+#include <stdint.h>
+
+/*
+ * Write a packed 8-bit RGB image as PNG. The zlib stream uses stored
+ * (uncompressed) blocks: no zlib dependency, and writing is as fast as
+ * the disk.
+ */
+int png_write_rgb(const char *path, const uint8_t *rgb, unsigned int width,
+        unsigned int height);
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <vector>
+#include <stddef.h>
+
+/*
+ * Bounded lock-free queue for exactly one producer thread and one consumer
+ * thread. push() and pop() never block; they fail when the ring is full or
+ * empty. Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity)
+        : head_(0), tail_cache_(0), tail_(0), head_cache_(0)
+    {
+        size_t cap = 1;
+
+        while (cap < capacity)
+            cap <<= 1;
+        slots_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    /* producer side */
+    bool push(const T &v)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head - tail_cache_ > mask_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head - tail_cache_ > mask_)
+                return false;
+        }
+        slots_[head & mask_] = v;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /* consumer side */
+    bool pop(T &v)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail == head_cache_)
+                return false;
+        }
+        v = slots_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    SpscRing(const SpscRing &);
+    SpscRing &operator=(const SpscRing &);
+
+    std::vector<T> slots_;
+    size_t mask_;
+
+    /* producer and consumer state live on separate cache lines */
+    char pad0_[64];
+    std::atomic<size_t> head_;
+    size_t tail_cache_;
+    char pad1_[64];
+    std::atomic<size_t> tail_;
+    size_t head_cache_;
+    char pad2_[64];
+};
+
+#endif
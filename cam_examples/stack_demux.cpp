@@ -0,0 +1,233 @@
+#include "stack_demux.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace std;
+
+int stack_layout_from_regs(uint8_t link_mask, uint8_t out_order,
+        struct stack_layout *layout)
+{
+    unsigned int i, slot, used = 0;
+
+    layout->count = 0;
+    for (i = 0; i < STACK_MAX_CAMERAS; i++)
+        layout->link[i] = -1;
+
+    for (i = 0; i < STACK_MAX_CAMERAS; i++)
+        if (link_mask & (1U << i))
+            layout->count++;
+
+    for (i = 0; i < STACK_MAX_CAMERAS; i++) {
+        if (!(link_mask & (1U << i)))
+            continue;
+        slot = (out_order >> (i * 2)) & 0x3;
+        /* linked inputs must own the first count slots, each exactly once */
+        if (slot >= layout->count || (used & (1U << slot)))
+            return -EINVAL;
+        used |= 1U << slot;
+        layout->link[slot] = i;
+    }
+    return layout->count ? 0 : -ENODEV;
+}
+
+void stack_layout_default(unsigned int count, struct stack_layout *layout)
+{
+    unsigned int i;
+
+    if (count > STACK_MAX_CAMERAS)
+        count = STACK_MAX_CAMERAS;
+    layout->count = count;
+    for (i = 0; i < STACK_MAX_CAMERAS; i++)
+        layout->link[i] = i < count ? (int)i : -1;
+}
+
+static int read_reg(int video_fd, unsigned int reg, uint8_t *val)
+{
+    struct v4l2_dbg_register dbg;
+
+    memset(&dbg, 0, sizeof(dbg));
+    dbg.match.type = V4L2_CHIP_MATCH_BRIDGE;
+    dbg.reg = reg;
+    if (ioctl(video_fd, VIDIOC_DBG_G_REGISTER, &dbg))
+        return -errno;
+    *val = dbg.val;
+    return 0;
+}
+
+int stack_layout_read(int video_fd, struct stack_layout *layout)
+{
+    uint8_t mask = 0, order = 0;
+    int ret;
+
+    ret = read_reg(video_fd, STACK_LINK_REG, &mask);
+    if (!ret)
+        ret = read_reg(video_fd, STACK_OUT_ORDER_REG, &order);
+    if (ret)
+        return ret;
+    return stack_layout_from_regs(mask & 0x0f, order, layout);
+}
+
+int stack_views(const struct stack_layout *layout, const void *frame,
+        size_t bytesperline, unsigned int width, unsigned int height,
+        struct stack_view *views)
+{
+    const uint8_t *p = (const uint8_t *)frame;
+    unsigned int i, h;
+
+    if (!layout->count || height % layout->count)
+        return -EINVAL;
+    h = height / layout->count;
+
+    for (i = 0; i < layout->count; i++) {
+        views[i].link = layout->link[i];
+        views[i].data = p + (size_t)i * h * bytesperline;
+        views[i].stride = bytesperline;
+        views[i].width = width;
+        views[i].height = h;
+        views[i].bytes = (size_t)h * bytesperline;
+    }
+    return layout->count;
+}
+
+bool stack_view_contiguous(const struct stack_view *v, unsigned int bytes_per_pixel)
+{
+    return v->stride == (size_t)v->width * bytes_per_pixel;
+}
+
+struct split_task {
+    const struct stack_view *   view;
+    void *                      dst;
+    unsigned int                bpp;
+};
+
+struct stack_splitter {
+    mutex                   lock;
+    condition_variable      work_cv;
+    condition_variable      done_cv;
+    vector<thread>          workers;
+    vector<split_task>      tasks;
+    unsigned long           generation;
+    unsigned int            pending;
+    bool                    quit;
+};
+
+static void copy_view(const struct split_task *t)
+{
+    const struct stack_view *v = t->view;
+    size_t row = (size_t)v->width * t->bpp;
+    uint8_t *d = (uint8_t *)t->dst;
+    unsigned int y;
+
+    /* memcpy is the vectorised copy on both NEON and SSE/AVX targets */
+    if (v->stride == row) {
+        memcpy(d, v->data, row * v->height);
+        return;
+    }
+    for (y = 0; y < v->height; y++)
+        memcpy(d + y * row, v->data + y * v->stride, row);
+}
+
+static void split_worker(struct stack_splitter *sp, unsigned int id)
+{
+    unsigned long seen = 0;
+    split_task task;
+
+    for (;;) {
+        {
+            unique_lock<mutex> l(sp->lock);
+
+            sp->work_cv.wait(l, [&] { return sp->quit || sp->generation != seen; });
+            if (sp->quit)
+                return;
+            seen = sp->generation;
+            if (id >= sp->tasks.size())
+                continue;
+            task = sp->tasks[id];
+        }
+        copy_view(&task);
+        {
+            lock_guard<mutex> l(sp->lock);
+
+            if (--sp->pending == 0)
+                sp->done_cv.notify_one();
+        }
+    }
+}
+
+struct stack_splitter *stack_splitter_create(unsigned int cameras)
+{
+    struct stack_splitter *sp = new stack_splitter;
+    unsigned int i;
+
+    if (cameras > STACK_MAX_CAMERAS)
+        cameras = STACK_MAX_CAMERAS;
+    sp->generation = 0;
+    sp->pending = 0;
+    sp->quit = false;
+    /* the calling thread copies stripe 0 itself */
+    for (i = 1; i < cameras; i++)
+        sp->workers.push_back(thread(split_worker, sp, i));
+    return sp;
+}
+
+void stack_splitter_destroy(struct stack_splitter *sp)
+{
+    size_t i;
+
+    {
+        lock_guard<mutex> l(sp->lock);
+
+        sp->quit = true;
+    }
+    sp->work_cv.notify_all();
+    for (i = 0; i < sp->workers.size(); i++)
+        sp->workers[i].join();
+    delete sp;
+}
+
+void stack_split(struct stack_splitter *sp, const struct stack_view *views,
+        unsigned int count, unsigned int bytes_per_pixel, void *const *dst)
+{
+    unsigned int i, threads = sp->workers.size() + 1;
+    split_task t;
+
+    if (!count)
+        return;
+    if (count > threads) {
+        /* more stripes than workers: not worth the hand-off */
+        for (i = 0; i < count; i++) {
+            t.view = &views[i];
+            t.dst = dst[i];
+            t.bpp = bytes_per_pixel;
+            copy_view(&t);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> l(sp->lock);
+
+        sp->tasks.resize(count);
+        for (i = 0; i < count; i++) {
+            sp->tasks[i].view = &views[i];
+            sp->tasks[i].dst = dst[i];
+            sp->tasks[i].bpp = bytes_per_pixel;
+        }
+        sp->pending = count - 1;
+        sp->generation++;
+        t = sp->tasks[0];
+    }
+    sp->work_cv.notify_all();
+
+    copy_view(&t);
+
+    unique_lock<mutex> l(sp->lock);
+    sp->done_cv.wait(l, [&] { return sp->pending == 0; });
+}
@@ -0,0 +1,68 @@
+#ifndef STACK_DEMUX_H
+#define STACK_DEMUX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * The max9286 outputs its linked cameras as one image, stacked top to
+ * bottom (1280 x 800*links YUYV). Register 0x49 holds the link mask in its
+ * low nibble. Register 0x0B gives every input link a 2-bit output slot
+ * (see set_output_order() in the driver). Slot s is stripe s of the image.
+ */
+
+#define STACK_MAX_CAMERAS       4
+#define STACK_LINK_REG          0x49
+#define STACK_OUT_ORDER_REG     0x0B
+
+struct stack_layout {
+    unsigned int    count;
+    /* input link feeding each stripe, top to bottom */
+    int             link[STACK_MAX_CAMERAS];
+};
+
+/* one camera's stripe inside the capture buffer; nothing is copied */
+struct stack_view {
+    int             link;
+    const uint8_t * data;
+    size_t          stride;
+    unsigned int    width;
+    unsigned int    height;
+    size_t          bytes;      /* stride * height */
+};
+
+int stack_layout_from_regs(uint8_t link_mask, uint8_t out_order,
+        struct stack_layout *layout);
+/* links 0..count-1 in ascending order, what the driver programs by default */
+void stack_layout_default(unsigned int count, struct stack_layout *layout);
+/*
+ * Ask the bridge driver for both registers through VIDIOC_DBG_G_REGISTER
+ * (needs CONFIG_VIDEO_ADV_DEBUG and CAP_SYS_ADMIN). Returns 0 or -errno.
+ */
+int stack_layout_read(int video_fd, struct stack_layout *layout);
+
+/*
+ * Fill views[] for a frame of width x height pixels, height covering all
+ * stripes. Returns the number of views, or -EINVAL if height does not
+ * split evenly.
+ */
+int stack_views(const struct stack_layout *layout, const void *frame,
+        size_t bytesperline, unsigned int width, unsigned int height,
+        struct stack_view *views);
+
+/* stride equals the packed row size: the stripe is one contiguous range */
+bool stack_view_contiguous(const struct stack_view *v, unsigned int bytes_per_pixel);
+
+/*
+ * Copies every stripe into its own packed buffer, one worker thread per
+ * camera, so per-camera consumers touch only their own camera's bytes.
+ */
+struct stack_splitter;
+
+struct stack_splitter *stack_splitter_create(unsigned int cameras);
+void stack_splitter_destroy(struct stack_splitter *sp);
+/* dst[i] receives views[i] packed to width*bpp per row; blocks until done */
+void stack_split(struct stack_splitter *sp, const struct stack_view *views,
+        unsigned int count, unsigned int bytes_per_pixel, void *const *dst);
+
+#endif
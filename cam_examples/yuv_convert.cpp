@@ -0,0 +1,638 @@
+#include "yuv_convert.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define YUV_HAVE_X86 1
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#define YUV_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* Q8 BT.601 coefficients, see yuv_convert.h */
+#define C_Y     298
+#define C_RV    409
+#define C_GU    100
+#define C_GV    208
+#define C_BU    517
+#define C_RND   128
+
+/*
+ * Row kernels. rgb() converts one row of width pixels, gray() extracts
+ * luma, chroma() averages the chroma of two rows into one NV12 UV row
+ * (v == NULL) or one row each of the I420 U and V planes. SIMD kernels
+ * hand the last, partial block to the scalar ones.
+ */
+struct row_kernels {
+    void (*rgb)(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy, int rgba);
+    void (*gray)(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy);
+    void (*chroma)(const uint8_t *s0, const uint8_t *s1, uint8_t *u, uint8_t *v,
+            unsigned int w, int uyvy);
+};
+
+static inline uint8_t clamp8(int v)
+{
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+static void rgb_row_c(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy, int rgba)
+{
+    int oy = uyvy ? 1 : 0, ou = uyvy ? 0 : 1;
+    int bpp = rgba ? 4 : 3;
+    int y0, y1, u, v, rc, gc, bc;
+    unsigned int x;
+
+    for (x = 0; x < w; x += 2, s += 4, d += 2 * bpp) {
+        y0 = C_Y * (s[oy] - 16);
+        y1 = C_Y * (s[oy + 2] - 16);
+        u = s[ou] - 128;
+        v = s[ou + 2] - 128;
+        rc = C_RV * v + C_RND;
+        gc = -C_GU * u - C_GV * v + C_RND;
+        bc = C_BU * u + C_RND;
+
+        d[0] = clamp8((y0 + rc) >> 8);
+        d[1] = clamp8((y0 + gc) >> 8);
+        d[2] = clamp8((y0 + bc) >> 8);
+        d[bpp + 0] = clamp8((y1 + rc) >> 8);
+        d[bpp + 1] = clamp8((y1 + gc) >> 8);
+        d[bpp + 2] = clamp8((y1 + bc) >> 8);
+        if (rgba) {
+            d[3] = 0xff;
+            d[bpp + 3] = 0xff;
+        }
+    }
+}
+
+static void gray_row_c(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy)
+{
+    unsigned int x;
+
+    s += uyvy ? 1 : 0;
+    for (x = 0; x < w; x++)
+        d[x] = s[x * 2];
+}
+
+static void chroma_row_c(const uint8_t *s0, const uint8_t *s1, uint8_t *u, uint8_t *v,
+        unsigned int w, int uyvy)
+{
+    int ou = uyvy ? 0 : 1;
+    unsigned int x;
+    uint8_t cu, cv;
+
+    for (x = 0; x < w; x += 2, s0 += 4, s1 += 4) {
+        cu = (s0[ou] + s1[ou] + 1) >> 1;
+        cv = (s0[ou + 2] + s1[ou + 2] + 1) >> 1;
+        if (v) {
+            u[x / 2] = cu;
+            v[x / 2] = cv;
+        } else {
+            u[x] = cu;
+            u[x + 1] = cv;
+        }
+    }
+}
+
+static const struct row_kernels kernels_c = {
+    rgb_row_c, gray_row_c, chroma_row_c,
+};
+
+#ifdef YUV_HAVE_X86
+
+/* pmaddwd coefficients for one (U, V) word pair */
+static inline int uv_coef(int cu, int cv)
+{
+    return (int)(((uint32_t)(uint16_t)cv << 16) | (uint16_t)cu);
+}
+
+/*
+ * 8 pixels (16 bytes) to R, G, B as int16. Luma is split into 16-bit
+ * Y (and 0xff or >> 8) and chroma words U0 V0 U1 V1 ...; one pmaddwd per
+ * channel then yields the chroma term of each pixel pair in 32 bits.
+ */
+__attribute__((target("sse2")))
+static inline void channels8_sse2(__m128i x, int uyvy, __m128i *r, __m128i *g, __m128i *b)
+{
+    const __m128i lo = _mm_set1_epi16(0xff);
+    const __m128i cy = _mm_set1_epi16(C_Y);
+    const __m128i rnd = _mm_set1_epi32(C_RND);
+    __m128i y, uv, ml, mh, y0, y1, rc, gc, bc;
+
+    y = uyvy ? _mm_srli_epi16(x, 8) : _mm_and_si128(x, lo);
+    uv = uyvy ? _mm_and_si128(x, lo) : _mm_srli_epi16(x, 8);
+    y = _mm_sub_epi16(y, _mm_set1_epi16(16));
+    uv = _mm_sub_epi16(uv, _mm_set1_epi16(128));
+
+    ml = _mm_mullo_epi16(y, cy);
+    mh = _mm_mulhi_epi16(y, cy);
+    y0 = _mm_add_epi32(_mm_unpacklo_epi16(ml, mh), rnd);
+    y1 = _mm_add_epi32(_mm_unpackhi_epi16(ml, mh), rnd);
+
+    rc = _mm_madd_epi16(uv, _mm_set1_epi32(uv_coef(0, C_RV)));
+    gc = _mm_madd_epi16(uv, _mm_set1_epi32(uv_coef(-C_GU, -C_GV)));
+    bc = _mm_madd_epi16(uv, _mm_set1_epi32(uv_coef(C_BU, 0)));
+
+#define CHANNEL_SSE2(c) _mm_packs_epi32( \
+        _mm_srai_epi32(_mm_add_epi32(y0, _mm_unpacklo_epi32(c, c)), 8), \
+        _mm_srai_epi32(_mm_add_epi32(y1, _mm_unpackhi_epi32(c, c)), 8))
+    *r = CHANNEL_SSE2(rc);
+    *g = CHANNEL_SSE2(gc);
+    *b = CHANNEL_SSE2(bc);
+#undef CHANNEL_SSE2
+}
+
+__attribute__((target("sse2")))
+static void rgb_row_sse2(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy, int rgba)
+{
+    const __m128i alpha = _mm_set1_epi8((char)0xff);
+    __m128i ra, ga, ba, rb, gb, bb, r, g, b, rg, ba8, q[4];
+    uint8_t tmp[64];
+    unsigned int x, i;
+    int bpp = rgba ? 4 : 3;
+
+    for (x = 0; x + 16 <= w; x += 16, s += 32, d += 16 * bpp) {
+        channels8_sse2(_mm_loadu_si128((const __m128i *)s), uyvy, &ra, &ga, &ba);
+        channels8_sse2(_mm_loadu_si128((const __m128i *)(s + 16)), uyvy, &rb, &gb, &bb);
+        r = _mm_packus_epi16(ra, rb);
+        g = _mm_packus_epi16(ga, gb);
+        b = _mm_packus_epi16(ba, bb);
+
+        rg = _mm_unpacklo_epi8(r, g);
+        ba8 = _mm_unpacklo_epi8(b, alpha);
+        q[0] = _mm_unpacklo_epi16(rg, ba8);
+        q[1] = _mm_unpackhi_epi16(rg, ba8);
+        rg = _mm_unpackhi_epi8(r, g);
+        ba8 = _mm_unpackhi_epi8(b, alpha);
+        q[2] = _mm_unpacklo_epi16(rg, ba8);
+        q[3] = _mm_unpackhi_epi16(rg, ba8);
+
+        if (rgba) {
+            for (i = 0; i < 4; i++)
+                _mm_storeu_si128((__m128i *)(d + i * 16), q[i]);
+            continue;
+        }
+        /* SSE2 has no byte shuffle; drop alpha in scalar code */
+        for (i = 0; i < 4; i++)
+            _mm_storeu_si128((__m128i *)(tmp + i * 16), q[i]);
+        for (i = 0; i < 16; i++) {
+            d[i * 3 + 0] = tmp[i * 4 + 0];
+            d[i * 3 + 1] = tmp[i * 4 + 1];
+            d[i * 3 + 2] = tmp[i * 4 + 2];
+        }
+    }
+    rgb_row_c(s, d, w - x, uyvy, rgba);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i luma8_sse2(__m128i x, int uyvy)
+{
+    return uyvy ? _mm_srli_epi16(x, 8) : _mm_and_si128(x, _mm_set1_epi16(0xff));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i chroma8_sse2(__m128i x, int uyvy)
+{
+    return uyvy ? _mm_and_si128(x, _mm_set1_epi16(0xff)) : _mm_srli_epi16(x, 8);
+}
+
+__attribute__((target("sse2")))
+static void gray_row_sse2(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy)
+{
+    unsigned int x;
+
+    for (x = 0; x + 16 <= w; x += 16, s += 32, d += 16)
+        _mm_storeu_si128((__m128i *)d, _mm_packus_epi16(
+                luma8_sse2(_mm_loadu_si128((const __m128i *)s), uyvy),
+                luma8_sse2(_mm_loadu_si128((const __m128i *)(s + 16)), uyvy)));
+    gray_row_c(s, d, w - x, uyvy);
+}
+
+__attribute__((target("sse2")))
+static void chroma_row_sse2(const uint8_t *s0, const uint8_t *s1, uint8_t *u, uint8_t *v,
+        unsigned int w, int uyvy)
+{
+    const __m128i lo = _mm_set1_epi16(0xff);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i c0, c1, avg;
+    unsigned int x;
+
+    for (x = 0; x + 16 <= w; x += 16, s0 += 32, s1 += 32) {
+        c0 = _mm_packus_epi16(chroma8_sse2(_mm_loadu_si128((const __m128i *)s0), uyvy),
+                chroma8_sse2(_mm_loadu_si128((const __m128i *)(s0 + 16)), uyvy));
+        c1 = _mm_packus_epi16(chroma8_sse2(_mm_loadu_si128((const __m128i *)s1), uyvy),
+                chroma8_sse2(_mm_loadu_si128((const __m128i *)(s1 + 16)), uyvy));
+        /* pavgb rounds up, the same as the scalar (a + b + 1) >> 1 */
+        avg = _mm_avg_epu8(c0, c1);
+        if (!v) {
+            _mm_storeu_si128((__m128i *)(u + x), avg);
+            continue;
+        }
+        _mm_storel_epi64((__m128i *)(u + x / 2), _mm_packus_epi16(_mm_and_si128(avg, lo), zero));
+        _mm_storel_epi64((__m128i *)(v + x / 2), _mm_packus_epi16(_mm_srli_epi16(avg, 8), zero));
+    }
+    chroma_row_c(s0, s1, v ? u + x / 2 : u + x, v ? v + x / 2 : NULL, w - x, uyvy);
+}
+
+static const struct row_kernels kernels_sse2 = {
+    rgb_row_sse2, gray_row_sse2, chroma_row_sse2,
+};
+
+/*
+ * The AVX2 kernels repeat the SSE2 arithmetic on two 128-bit lanes. Packs
+ * work per lane, so packed results are put back in pixel order with
+ * vpermq (0xd8: quadwords 0, 2, 1, 3).
+ */
+__attribute__((target("avx2")))
+static inline void channels16_avx2(__m256i x, int uyvy, __m256i *r, __m256i *g, __m256i *b)
+{
+    const __m256i lo = _mm256_set1_epi16(0xff);
+    const __m256i cy = _mm256_set1_epi16(C_Y);
+    const __m256i rnd = _mm256_set1_epi32(C_RND);
+    __m256i y, uv, ml, mh, y0, y1, rc, gc, bc;
+
+    y = uyvy ? _mm256_srli_epi16(x, 8) : _mm256_and_si256(x, lo);
+    uv = uyvy ? _mm256_and_si256(x, lo) : _mm256_srli_epi16(x, 8);
+    y = _mm256_sub_epi16(y, _mm256_set1_epi16(16));
+    uv = _mm256_sub_epi16(uv, _mm256_set1_epi16(128));
+
+    ml = _mm256_mullo_epi16(y, cy);
+    mh = _mm256_mulhi_epi16(y, cy);
+    y0 = _mm256_add_epi32(_mm256_unpacklo_epi16(ml, mh), rnd);
+    y1 = _mm256_add_epi32(_mm256_unpackhi_epi16(ml, mh), rnd);
+
+    rc = _mm256_madd_epi16(uv, _mm256_set1_epi32(uv_coef(0, C_RV)));
+    gc = _mm256_madd_epi16(uv, _mm256_set1_epi32(uv_coef(-C_GU, -C_GV)));
+    bc = _mm256_madd_epi16(uv, _mm256_set1_epi32(uv_coef(C_BU, 0)));
+
+#define CHANNEL_AVX2(c) _mm256_packs_epi32( \
+        _mm256_srai_epi32(_mm256_add_epi32(y0, _mm256_unpacklo_epi32(c, c)), 8), \
+        _mm256_srai_epi32(_mm256_add_epi32(y1, _mm256_unpackhi_epi32(c, c)), 8))
+    *r = CHANNEL_AVX2(rc);
+    *g = CHANNEL_AVX2(gc);
+    *b = CHANNEL_AVX2(bc);
+#undef CHANNEL_AVX2
+}
+
+__attribute__((target("avx2")))
+static inline __m256i packus_ordered_avx2(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+}
+
+__attribute__((target("avx2")))
+static void rgb_row_avx2(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy, int rgba)
+{
+    const __m256i alpha = _mm256_set1_epi8((char)0xff);
+    const __m128i drop_alpha = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+            -1, -1, -1, -1);
+    __m256i ra, ga, ba, rb, gb, bb, r, g, b, rg, ba8, q0, q1, q2, q3, o[4];
+    __m128i t;
+    uint32_t tail;
+    unsigned int x, i, j;
+    int bpp = rgba ? 4 : 3;
+
+    for (x = 0; x + 32 <= w; x += 32, s += 64, d += 32 * bpp) {
+        channels16_avx2(_mm256_loadu_si256((const __m256i *)s), uyvy, &ra, &ga, &ba);
+        channels16_avx2(_mm256_loadu_si256((const __m256i *)(s + 32)), uyvy, &rb, &gb, &bb);
+        r = packus_ordered_avx2(ra, rb);
+        g = packus_ordered_avx2(ga, gb);
+        b = packus_ordered_avx2(ba, bb);
+
+        /* lane 0 holds pixels 0-15, lane 1 pixels 16-31 */
+        rg = _mm256_unpacklo_epi8(r, g);
+        ba8 = _mm256_unpacklo_epi8(b, alpha);
+        q0 = _mm256_unpacklo_epi16(rg, ba8);    /* 0-3   | 16-19 */
+        q1 = _mm256_unpackhi_epi16(rg, ba8);    /* 4-7   | 20-23 */
+        rg = _mm256_unpackhi_epi8(r, g);
+        ba8 = _mm256_unpackhi_epi8(b, alpha);
+        q2 = _mm256_unpacklo_epi16(rg, ba8);    /* 8-11  | 24-27 */
+        q3 = _mm256_unpackhi_epi16(rg, ba8);    /* 12-15 | 28-31 */
+        o[0] = _mm256_permute2x128_si256(q0, q1, 0x20);
+        o[1] = _mm256_permute2x128_si256(q2, q3, 0x20);
+        o[2] = _mm256_permute2x128_si256(q0, q1, 0x31);
+        o[3] = _mm256_permute2x128_si256(q2, q3, 0x31);
+
+        if (rgba) {
+            for (i = 0; i < 4; i++)
+                _mm256_storeu_si256((__m256i *)(d + i * 32), o[i]);
+            continue;
+        }
+        for (i = 0; i < 4; i++) {
+            for (j = 0; j < 2; j++) {
+                t = j ? _mm256_extracti128_si256(o[i], 1) : _mm256_castsi256_si128(o[i]);
+                t = _mm_shuffle_epi8(t, drop_alpha);
+                /* 12 bytes: never write past the end of the row */
+                _mm_storel_epi64((__m128i *)(d + (i * 2 + j) * 12), t);
+                tail = _mm_cvtsi128_si32(_mm_srli_si128(t, 8));
+                memcpy(d + (i * 2 + j) * 12 + 8, &tail, 4);
+            }
+        }
+    }
+    rgb_row_sse2(s, d, w - x, uyvy, rgba);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i luma16_avx2(__m256i x, int uyvy)
+{
+    return uyvy ? _mm256_srli_epi16(x, 8) : _mm256_and_si256(x, _mm256_set1_epi16(0xff));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i chroma16_avx2(__m256i x, int uyvy)
+{
+    return uyvy ? _mm256_and_si256(x, _mm256_set1_epi16(0xff)) : _mm256_srli_epi16(x, 8);
+}
+
+__attribute__((target("avx2")))
+static void gray_row_avx2(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy)
+{
+    unsigned int x;
+
+    for (x = 0; x + 32 <= w; x += 32, s += 64, d += 32)
+        _mm256_storeu_si256((__m256i *)d, packus_ordered_avx2(
+                luma16_avx2(_mm256_loadu_si256((const __m256i *)s), uyvy),
+                luma16_avx2(_mm256_loadu_si256((const __m256i *)(s + 32)), uyvy)));
+    gray_row_sse2(s, d, w - x, uyvy);
+}
+
+__attribute__((target("avx2")))
+static void chroma_row_avx2(const uint8_t *s0, const uint8_t *s1, uint8_t *u, uint8_t *v,
+        unsigned int w, int uyvy)
+{
+    const __m256i lo = _mm256_set1_epi16(0xff);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i c0, c1, avg;
+    unsigned int x;
+
+    for (x = 0; x + 32 <= w; x += 32, s0 += 64, s1 += 64) {
+        c0 = packus_ordered_avx2(chroma16_avx2(_mm256_loadu_si256((const __m256i *)s0), uyvy),
+                chroma16_avx2(_mm256_loadu_si256((const __m256i *)(s0 + 32)), uyvy));
+        c1 = packus_ordered_avx2(chroma16_avx2(_mm256_loadu_si256((const __m256i *)s1), uyvy),
+                chroma16_avx2(_mm256_loadu_si256((const __m256i *)(s1 + 32)), uyvy));
+        avg = _mm256_avg_epu8(c0, c1);
+        if (!v) {
+            _mm256_storeu_si256((__m256i *)(u + x), avg);
+            continue;
+        }
+        _mm_storeu_si128((__m128i *)(u + x / 2), _mm256_castsi256_si128(
+                packus_ordered_avx2(_mm256_and_si256(avg, lo), zero)));
+        _mm_storeu_si128((__m128i *)(v + x / 2), _mm256_castsi256_si128(
+                packus_ordered_avx2(_mm256_srli_epi16(avg, 8), zero)));
+    }
+    chroma_row_sse2(s0, s1, v ? u + x / 2 : u + x, v ? v + x / 2 : NULL, w - x, uyvy);
+}
+
+static const struct row_kernels kernels_avx2 = {
+    rgb_row_avx2, gray_row_avx2, chroma_row_avx2,
+};
+
+#endif /* YUV_HAVE_X86 */
+
+#ifdef YUV_HAVE_NEON
+
+/*
+ * vld4 splits 16 pixels into even luma, U, odd luma and V, so even and
+ * odd pixels share the chroma terms without any shuffling. vqrshrn #8 is
+ * the scalar (x + 128) >> 8 with saturation.
+ */
+static inline uint8x8_t channel8_neon(int16x8_t y, int32x4_t clo, int32x4_t chi)
+{
+    return vqmovun_s16(vcombine_s16(
+            vqrshrn_n_s32(vmlal_n_s16(clo, vget_low_s16(y), C_Y), 8),
+            vqrshrn_n_s32(vmlal_n_s16(chi, vget_high_s16(y), C_Y), 8)));
+}
+
+static inline uint8x16_t zip16_neon(uint8x8_t even, uint8x8_t odd)
+{
+    return vcombine_u8(vzip1_u8(even, odd), vzip2_u8(even, odd));
+}
+
+static void rgb_row_neon(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy, int rgba)
+{
+    const uint8x8_t c16 = vdup_n_u8(16), c128 = vdup_n_u8(128);
+    uint8x8x4_t p;
+    uint8x16x4_t o;
+    int16x8_t ye, yo, u, v;
+    int32x4_t rlo, rhi, glo, ghi, blo, bhi;
+    unsigned int x;
+    int bpp = rgba ? 4 : 3;
+
+    o.val[3] = vdupq_n_u8(0xff);
+    for (x = 0; x + 16 <= w; x += 16, s += 32, d += 16 * bpp) {
+        p = vld4_u8(s);
+        ye = vreinterpretq_s16_u16(vsubl_u8(p.val[uyvy ? 1 : 0], c16));
+        yo = vreinterpretq_s16_u16(vsubl_u8(p.val[uyvy ? 3 : 2], c16));
+        u = vreinterpretq_s16_u16(vsubl_u8(p.val[uyvy ? 0 : 1], c128));
+        v = vreinterpretq_s16_u16(vsubl_u8(p.val[uyvy ? 2 : 3], c128));
+
+        rlo = vmull_n_s16(vget_low_s16(v), C_RV);
+        rhi = vmull_n_s16(vget_high_s16(v), C_RV);
+        glo = vmlsl_n_s16(vmull_n_s16(vget_low_s16(u), -C_GU), vget_low_s16(v), C_GV);
+        ghi = vmlsl_n_s16(vmull_n_s16(vget_high_s16(u), -C_GU), vget_high_s16(v), C_GV);
+        blo = vmull_n_s16(vget_low_s16(u), C_BU);
+        bhi = vmull_n_s16(vget_high_s16(u), C_BU);
+
+        o.val[0] = zip16_neon(channel8_neon(ye, rlo, rhi), channel8_neon(yo, rlo, rhi));
+        o.val[1] = zip16_neon(channel8_neon(ye, glo, ghi), channel8_neon(yo, glo, ghi));
+        o.val[2] = zip16_neon(channel8_neon(ye, blo, bhi), channel8_neon(yo, blo, bhi));
+
+        if (rgba) {
+            vst4q_u8(d, o);
+        } else {
+            uint8x16x3_t o3;
+
+            o3.val[0] = o.val[0];
+            o3.val[1] = o.val[1];
+            o3.val[2] = o.val[2];
+            vst3q_u8(d, o3);
+        }
+    }
+    rgb_row_c(s, d, w - x, uyvy, rgba);
+}
+
+static void gray_row_neon(const uint8_t *s, uint8_t *d, unsigned int w, int uyvy)
+{
+    uint8x16x2_t p;
+    unsigned int x;
+
+    for (x = 0; x + 16 <= w; x += 16, s += 32, d += 16) {
+        p = vld2q_u8(s);
+        vst1q_u8(d, p.val[uyvy ? 1 : 0]);
+    }
+    gray_row_c(s, d, w - x, uyvy);
+}
+
+static void chroma_row_neon(const uint8_t *s0, const uint8_t *s1, uint8_t *u, uint8_t *v,
+        unsigned int w, int uyvy)
+{
+    uint8x16x2_t p0, p1;
+    uint8x8x4_t q0, q1;
+    unsigned int x;
+
+    for (x = 0; x + 16 <= w; x += 16, s0 += 32, s1 += 32) {
+        if (!v) {
+            p0 = vld2q_u8(s0);
+            p1 = vld2q_u8(s1);
+            vst1q_u8(u + x, vrhaddq_u8(p0.val[uyvy ? 0 : 1], p1.val[uyvy ? 0 : 1]));
+            continue;
+        }
+        q0 = vld4_u8(s0);
+        q1 = vld4_u8(s1);
+        vst1_u8(u + x / 2, vrhadd_u8(q0.val[uyvy ? 0 : 1], q1.val[uyvy ? 0 : 1]));
+        vst1_u8(v + x / 2, vrhadd_u8(q0.val[uyvy ? 2 : 3], q1.val[uyvy ? 2 : 3]));
+    }
+    chroma_row_c(s0, s1, v ? u + x / 2 : u + x, v ? v + x / 2 : NULL, w - x, uyvy);
+}
+
+static const struct row_kernels kernels_neon = {
+    rgb_row_neon, gray_row_neon, chroma_row_neon,
+};
+
+#endif /* YUV_HAVE_NEON */
+
+bool yuv_isa_supported(enum yuv_isa isa)
+{
+    switch (isa) {
+    case YUV_ISA_AUTO:
+    case YUV_ISA_SCALAR:
+        return true;
+#ifdef YUV_HAVE_X86
+    case YUV_ISA_SSE2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+    case YUV_ISA_AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+#ifdef YUV_HAVE_NEON
+    case YUV_ISA_NEON:
+        /* Advanced SIMD is mandatory on AArch64 */
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+enum yuv_isa yuv_best_isa(void)
+{
+    static const enum yuv_isa order[] = {
+        YUV_ISA_AVX2, YUV_ISA_NEON, YUV_ISA_SSE2,
+    };
+    unsigned int i;
+
+    for (i = 0; i < sizeof(order) / sizeof(order[0]); i++)
+        if (yuv_isa_supported(order[i]))
+            return order[i];
+    return YUV_ISA_SCALAR;
+}
+
+const char *yuv_isa_name(enum yuv_isa isa)
+{
+    switch (isa) {
+    case YUV_ISA_AUTO:
+        return "auto";
+    case YUV_ISA_SCALAR:
+        return "scalar";
+    case YUV_ISA_SSE2:
+        return "sse2";
+    case YUV_ISA_AVX2:
+        return "avx2";
+    case YUV_ISA_NEON:
+        return "neon";
+    }
+    return "unknown";
+}
+
+static const struct row_kernels *pick_kernels(enum yuv_isa isa)
+{
+    if (isa == YUV_ISA_AUTO)
+        isa = yuv_best_isa();
+    if (!yuv_isa_supported(isa))
+        return NULL;
+
+    switch (isa) {
+#ifdef YUV_HAVE_X86
+    case YUV_ISA_SSE2:
+        return &kernels_sse2;
+    case YUV_ISA_AVX2:
+        return &kernels_avx2;
+#endif
+#ifdef YUV_HAVE_NEON
+    case YUV_ISA_NEON:
+        return &kernels_neon;
+#endif
+    default:
+        return &kernels_c;
+    }
+}
+
+size_t yuv_output_size(enum yuv_output out, unsigned int width, unsigned int height)
+{
+    size_t pixels = (size_t)width * height;
+
+    switch (out) {
+    case YUV_OUT_RGB24:
+        return pixels * 3;
+    case YUV_OUT_RGBA:
+        return pixels * 4;
+    case YUV_OUT_NV12:
+    case YUV_OUT_I420:
+        return pixels + pixels / 2;
+    case YUV_OUT_GRAY:
+        return pixels;
+    }
+    return 0;
+}
+
+int yuv_convert(const void *src, size_t src_stride, enum yuv_packed in,
+        void *dst, enum yuv_output out, unsigned int width, unsigned int height,
+        enum yuv_isa isa)
+{
+    const struct row_kernels *k = pick_kernels(isa);
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t *d = (uint8_t *)dst;
+    uint8_t *plane_u = d + (size_t)width * height;
+    uint8_t *plane_v = plane_u + (size_t)width * height / 4;
+    int uyvy = in == YUV_UYVY;
+    unsigned int y;
+
+    if (!k)
+        return -ENOTSUP;
+    if (width & 1)
+        return -EINVAL;
+    if ((out == YUV_OUT_NV12 || out == YUV_OUT_I420) && (height & 1))
+        return -EINVAL;
+
+    switch (out) {
+    case YUV_OUT_RGB24:
+    case YUV_OUT_RGBA:
+        for (y = 0; y < height; y++)
+            k->rgb(s + y * src_stride, d + (size_t)y * width * (out == YUV_OUT_RGBA ? 4 : 3),
+                    width, uyvy, out == YUV_OUT_RGBA);
+        break;
+    case YUV_OUT_GRAY:
+        for (y = 0; y < height; y++)
+            k->gray(s + y * src_stride, d + (size_t)y * width, width, uyvy);
+        break;
+    case YUV_OUT_NV12:
+    case YUV_OUT_I420:
+        for (y = 0; y < height; y++)
+            k->gray(s + y * src_stride, d + (size_t)y * width, width, uyvy);
+        for (y = 0; y < height; y += 2) {
+            if (out == YUV_OUT_NV12)
+                k->chroma(s + y * src_stride, s + (y + 1) * src_stride,
+                        plane_u + (size_t)y / 2 * width, NULL, width, uyvy);
+            else
+                k->chroma(s + y * src_stride, s + (y + 1) * src_stride,
+                        plane_u + (size_t)y / 2 * (width / 2),
+                        plane_v + (size_t)y / 2 * (width / 2), width, uyvy);
+        }
+        break;
+    }
+    return 0;
+}
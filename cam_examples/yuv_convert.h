@@ -0,0 +1,58 @@
+#ifndef YUV_CONVERT_H
+#define YUV_CONVERT_H
+
+#include <stddef.h>
+
+/*
+ * Packed 4:2:2 (YUYV / UYVY) to RGB and planar conversions.
+ *
+ * Colour conversion is BT.601 limited range in Q8 fixed point, the same
+ * coefficients yuyv2png.py used (1.164, 1.596, 0.813, 0.391, 2.018):
+ *   R = (298 (Y-16)               + 409 (V-128) + 128) >> 8
+ *   G = (298 (Y-16) - 100 (U-128) - 208 (V-128) + 128) >> 8
+ *   B = (298 (Y-16) + 517 (U-128)               + 128) >> 8
+ * each clamped to 0..255. Vertical chroma subsampling for NV12/I420
+ * averages the two rows rounding up, (a + b + 1) >> 1.
+ *
+ * Every ISA produces bit-identical output; the scalar path is the
+ * reference.
+ */
+
+enum yuv_packed {
+    YUV_YUYV,
+    YUV_UYVY,
+};
+
+enum yuv_output {
+    YUV_OUT_RGB24,
+    YUV_OUT_RGBA,
+    YUV_OUT_NV12,
+    YUV_OUT_I420,
+    YUV_OUT_GRAY,
+};
+
+enum yuv_isa {
+    YUV_ISA_AUTO,
+    YUV_ISA_SCALAR,
+    YUV_ISA_SSE2,
+    YUV_ISA_AVX2,
+    YUV_ISA_NEON,
+};
+
+/* bytes needed for a tightly packed output image */
+size_t yuv_output_size(enum yuv_output out, unsigned int width, unsigned int height);
+
+/*
+ * width must be even, and height too for NV12/I420. Returns 0, or -EINVAL
+ * for bad geometry, or -ENOTSUP when isa cannot run on this CPU.
+ */
+int yuv_convert(const void *src, size_t src_stride, enum yuv_packed in,
+        void *dst, enum yuv_output out, unsigned int width, unsigned int height,
+        enum yuv_isa isa);
+
+bool yuv_isa_supported(enum yuv_isa isa);
+/* what YUV_ISA_AUTO picks */
+enum yuv_isa yuv_best_isa(void);
+const char *yuv_isa_name(enum yuv_isa isa);
+
+#endif
@@ -34,89 +34,75 @@
 #endif
 
 #if defined(IS_LINUX)
-#define max20088_cmd_addr "/sys/devices/platform/11010000.i2c/i2c-3/3-0068/register_addr"
-#define max20088_cmd_val "/sys/devices/platform/11010000.i2c/i2c-3/3-0068/linux_register_max20088"
+#include <sys/ioctl.h>
+#include "../max_reg_batch.h"
+/* MAX20088 behind the max9288 on i2c-3, read through its batch node */
+#define max9288_regs "/dev/max9288_regs"
+#define MAX20088_SLAVE 0x52
 #define max20086_cmd_addr "/sys/devices/platform/11009000.i2c/i2c-2/2-0048/register_addr"
 #define max20086_cmd_val "/sys/devices/platform/11009000.i2c/i2c-2/2-0048/linux_register_max20086"
 char staBuff[255][255]={0};
 char max20088_linux_status()
 {
-    int i = 0,j = 0;
+    int i = 0;
     int ret = 0;
-    char buff[10]={0};
-    char buff_t[10]={0};
-    char val[20][20]={0};
-    int addr[10] = {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09};
-    int fd,fd_t;
-    memset(staBuff,0,255);
-    fd = open(max20088_cmd_addr, O_RDWR /* required */ | O_NONBLOCK);
+    int fd;
+    struct max_reg_access acc[10];
+    struct max_reg_batch batch;
+
+    memset(staBuff,0,sizeof(staBuff));
+    memset(acc,0,sizeof(acc));
+    fd = open(max9288_regs, O_RDWR);
     if (fd < 0){
         LOGE("open failed\n");
-        close(fd);
-        return fd;
-    }
-    fd_t = open(max20088_cmd_val, O_RDWR /* required */ | O_NONBLOCK);
-    if (fd_t < 0){
-        LOGE("open failed\n");
-        close(fd_t);
         return fd;
     }
 
+    /* registers 0x00..0x09 in one ioctl, one bus transfer */
     for (i = 0;i<10;i++){
-        memset(buff,0,10);
-        sprintf(buff,"0x%02x",addr[i]);
-        LOGI("buff=%s,length=%lu\n",buff,strlen(buff));
-        write(fd,buff,strlen(buff));
-        for(j=0;j<3;j++){
-            lseek(fd_t,0,SEEK_SET);
-            ret = read(fd_t,buff_t,4);
-            if(ret < 0){
-                LOGE("read error1\n");
-                return ret;
-            }else if (ret == 0){
-                printf("ret:0\n");
-            }else{
-                printf("ret = %d\n",ret);
-                
-            }
-        }
-        //printf("buff_t=%s\n",buff_t);
-        sprintf(buff_t,"%s",buff_t);
-        //printf("buff_t=%s\n",buff_t);
-        strcpy(val[i],buff_t);
-        printf("----------------\n");
+        acc[i].slave = MAX20088_SLAVE;
+        acc[i].op = MAX_REG_OP_READ;
+        acc[i].reg_len = 1;
+        acc[i].len = 1;
+        acc[i].reg = i;
+    }
+    batch.count = 10;
+    batch.accesses = (unsigned long)acc;
+    ret = ioctl(fd, MAX_REG_IOC_BATCH, &batch);
+    close(fd);
+    if (ret < 0 || batch.failed != 0){
+        LOGE("read error, %u registers failed\n",batch.failed);
+        return -1;
     }
 
     LOGI("ADDR:  ");
     for (i=0;i<10;i++){
-        LOGI("0x%02x\t",addr[i]);
+        LOGI("0x%02x\t",acc[i].reg);
     }
     LOGI("\n");
     LOGI("VALUE: ");
     for (i=0;i<10;i++){
-        printf("%s\t",val[i]);
+        printf("0x%02x\t",acc[i].val[0]);
     }
     LOGI(" \nDiagnosis information:\n");
-    if (strcmp(val[2],"0x11")==0){
+    if (acc[2].val[0] == 0x11){
         LOGI("MAX20088 ID matched!\n");
         strcpy(staBuff[0],"ID:MAX20088.");
     }else{
         LOGE("MAX20088 ID ERROR!\n");
     }
 
-    if (strcmp(val[4],"0x05")==0 && strcmp(val[6],"0x00")==0){
+    if (acc[4].val[0] == 0x05 && acc[6].val[0] == 0x00){
         strcpy(staBuff[1],"Over-current present and Output voltage < UV threshold");
         return 1;
-    }else if (strcmp(val[6],"0x00")==0){
+    }else if (acc[6].val[0] == 0x00){
         strcpy(staBuff[2],"camera not connected!");
         return 2;
     }else{
         LOGI("camera connected!\n");
     }
 
-    close(fd);
-    close(fd_t);
-    return ret;
+    return 0;
 }
 #endif
 #if defined(IS_ANDROID)
@@ -13,11 +13,22 @@
 #include <linux/delay.h>
 #include <linux/i2c.h>
 #include <linux/kernel.h>
+#include <linux/ktime.h>
+#include <linux/mutex.h>
+#include <linux/cache.h>
+#include <linux/math64.h>
+#include <linux/completion.h>
+#include <linux/workqueue.h>
+#include <linux/pm.h>
+#include <linux/regmap.h>
 #include <linux/slab.h>
 #include <linux/videodev2.h>
 #include <linux/module.h>
 #include <linux/v4l2-mediabus.h>
 #include <linux/media-bus-format.h>
+#include <linux/miscdevice.h>
+#include <linux/fs.h>
+#include <linux/uaccess.h>
 
 #include <linux/clk.h>
 #include <media/soc_camera.h>
@@ -25,6 +36,8 @@
 #include <media/v4l2-subdev.h>
 #include <linux/regulator/consumer.h>
 
+#include "max_reg_batch.h"
+
 /*
  * About MAX resolution, cropping and binning:
  * This sensor supports it all, at least in the feature description.
@@ -46,6 +59,10 @@
 #define MAX9286_OUTLANE_REG_ADDR 0x12U
 #define MAX9286_F_R_CTL_REG_ADDR 0x0AU
 #define MAX_REG_LEN 2
+/* one register access: address bytes plus up to two data bytes */
+#define MAX9286_XFER_LEN 8
+/* register_dump: one auto-increment read covers a whole 8 bit register map */
+#define MAX9286_DUMP_LEN 256
 #define MAX96705_INIT_ADDR 0x80
 #define MAX96705_ALL_ADDR 0x80
 #define MAX96705_CH0_ADDR 0x82
@@ -58,6 +75,8 @@
 #define ISX016_CH1_MAP_ADDR 0x62
 #define ISX016_CH2_MAP_ADDR 0x64
 #define ISX016_CH3_MAP_ADDR 0x66
+/* power-over-coax switch, see the android_register_max20088 attribute */
+#define MAX20088_ADDR 0x50
 #define MAX9286_1CH_LANE 1
 //#define KSS_TEST_PATTERN
 
@@ -65,6 +84,13 @@
 #define MAX9286_ID_REG   0x1E
 #define MAX9286_LOCK_REG 0x27
 #define MAX9286_LINK_REG 0x49
+#define MAX96705_ADDR_REG 0x00
+/* MAX9286_LOCK_REG: all enabled links locked */
+#define MAX9286_LOCKED 0x80
+/* MAX9286_LINK_REG: config link detected, one bit per link */
+#define MAX9286_CFG_LINK_MASK 0xF0
+/* i2c_poll: gap between two reads of the polled register */
+#define MAX9286_POLL_US 200
 
 /* minimum extra blanking */
 #define BLANKING_EXTRA_WIDTH		500
@@ -118,6 +144,9 @@ struct reg_val_ops {
 	unsigned int reg_len;
 	int (*i2c_ops)(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val);
+	/* i2c_poll only: wait for (reg & mask) == val, at most timeout ms */
+	u8 mask;
+	u8 timeout;
 };
 
 static int i2c_write(struct i2c_client *client, u16 slave_addr,
@@ -126,6 +155,8 @@ static int i2c_read(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val);
 static int i2c_delay(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *value);
+static int i2c_poll(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val);
 static int read_max9286_id(struct i2c_client *client, u8 *id_val);
 static int max9286_write_array(struct i2c_client *client,
 		struct reg_val_ops *cmd, unsigned long len);
@@ -156,6 +187,18 @@ static const struct max9286_win_size max9286_supported_win_sizes[] = {
 
 static int is_testpattern;
 static int is_exec_testpattern;
+
+/*
+ * Skip writes whose value the register cache already holds. With 0
+ * everything goes to the bus again; the caches are still kept.
+ */
+static int cache_writes = 1;
+
+/*
+ * Program the settings all MAX96705 share once through MAX96705_ALL_ADDR
+ * instead of once per link. 0: one serializer at a time, as it used to be.
+ */
+static int broadcast_init = 1;
 struct sensor_addr {
 	u16 ser_init_addr;
 	u16 ser_last_addr;
@@ -189,7 +232,9 @@ static struct reg_val_ops MAX9286_camera_pre_init_cmd[] = {
 	{MAX9286_ADDR,       {0x00, 0x00}, 0x02,               0x01, i2c_delay},
 	{MAX96705_INIT_ADDR, {0x04, 0x00}, 0x43,               0x01, i2c_write},
 	{MAX96705_INIT_ADDR, {0x03, 0x00}, 0x80,               0x01, i2c_write}, // add by nio
-	{MAX9286_ADDR,       {0x00, 0x00}, 0x05,               0x01, i2c_delay},
+	/* config links up; with less than four cameras this takes the full 5 ms */
+	{MAX9286_ADDR,       {MAX9286_LINK_REG, 0x00}, MAX9286_CFG_LINK_MASK, 0x01, i2c_poll,
+		MAX9286_CFG_LINK_MASK, 5},
 	{MAX9286_ADDR,       {0x28, 0x00}, 0x00,               0x01, i2c_read},
 	{MAX9286_ADDR,       {0x28, 0x00}, 0x00,               0x01, i2c_read},
 	{MAX9286_ADDR,       {0x29, 0x00}, 0x00,               0x01, i2c_read},
@@ -210,6 +255,29 @@ static struct reg_val_ops MAX9286_camera_pre_init_cmd[] = {
 	{MAX9286_ADDR,       {0x15, 0x00}, 0x13,                0x01, i2c_write},
 };
 
+/*
+ * The serializer half of MAX9286_camera_pre_init_cmd, plus 0x07: for a
+ * serializer that came back at its power-on address while the MAX9286
+ * kept its setup. The reverse channel amplitude goes up for it meanwhile.
+ * Split where the pre-init table polls for all config links: the healthy
+ * links stay in video mode, max9286_recover_links() polls the lost ones.
+ */
+static struct reg_val_ops MAX96705_link_recover_cmd[] = {
+	{MAX9286_ADDR,       {0x3B, 0x00}, 0x1E,               0x01, i2c_write},
+	{MAX9286_ADDR,       {0x00, 0x00}, 0x02,               0x01, i2c_delay},
+	{MAX96705_INIT_ADDR, {0x04, 0x00}, 0x43,               0x01, i2c_write},
+	{MAX96705_INIT_ADDR, {0x03, 0x00}, 0x80,               0x01, i2c_write},
+};
+
+static struct reg_val_ops MAX96705_link_recover_cfg_cmd[] = {
+	{MAX96705_INIT_ADDR, {0x08, 0x00}, 0x01,               0x01, i2c_write},
+	{MAX96705_INIT_ADDR, {0x97, 0x00}, 0xAF,               0x01, i2c_write},
+	{MAX9286_ADDR,       {0x00, 0x00}, 0x02,               0x01, i2c_delay},
+	{MAX9286_ADDR,       {0x3B, 0x00}, 0x19,               0x01, i2c_write},
+	{MAX9286_ADDR,       {0x00, 0x00}, 0x02,               0x01, i2c_delay},
+	{MAX96705_INIT_ADDR, {0x07, 0x00}, 0x84,               0x01, i2c_write},
+};
+
 static struct reg_val_ops MAX9286_camera_init_cmd[] = {
 	{MAX9286_ADDR,      {0x19, 0x00}, 0xa3,               0x01, i2c_write},
 	{MAX9286_ADDR,      {0x41, 0x00}, 0x10,               0x01, i2c_write},
@@ -218,28 +286,37 @@ static struct reg_val_ops MAX9286_camera_init_cmd[] = {
 	{MAX9286_ADDR,      {0x64, 0x00}, 0x00,               0x01, i2c_write},
 };
 
+/*
+ * Serializer settings that are the same on every link. Before the address
+ * remap every linked MAX96705 still answers at MAX96705_ALL_ADDR, so with
+ * all links enabled one write programs all of them, see broadcast_init.
+ */
+static struct reg_val_ops MAX96705_common_init_cmd[] = {
+	{MAX96705_ALL_ADDR, {0x06, 0x00}, 0x80,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x0E, 0x00}, 0x00,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3f, 0x00}, 0x0d,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x41, 0x00}, 0x0e,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x43, 0x00}, 0x01,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x44, 0x00}, 0x23,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x45, 0x00}, 0xa9,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x46, 0x00}, 0xd4,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x47, 0x00}, 0x01,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x48, 0x00}, 0x00,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x49, 0x00}, 0x00,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x4a, 0x00}, 0x24,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x4b, 0x00}, 0xd7,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x4c, 0x00}, 0x80,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x43, 0x00}, 0x21,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x4d, 0x00}, 0x00,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x67, 0x00}, 0xc4,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x07, 0x00}, 0x84,               0x01, i2c_write},
+};
+
+/* what has to go to each serializer on its own: address and I2C remaps */
 #define MAX9286_CAMERA_CH_ADDR_INIT_CMD(ch)\
 	static struct reg_val_ops MAX9286_CAMERA_CH##ch##_addr_init_cmd[] = {\
 		{MAX9286_ADDR,           {0x0A, 0x00}, (0x01U) << ch | 0xF0,     0x01, i2c_write}, \
 		{MAX96705_INIT_ADDR,     {0x00, 0x00}, MAX96705_CH##ch##_ADDR,   0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x06, 0x00}, 0x80,	                 0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x0E, 0x00}, 0x00,	                 0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x3f, 0x00}, 0x0d,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x41, 0x00}, 0x0e,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x43, 0x00}, 0x01,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x44, 0x00}, 0x23,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x45, 0x00}, 0xa9,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x46, 0x00}, 0xd4,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x47, 0x00}, 0x01,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x48, 0x00}, 0x00,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x49, 0x00}, 0x00,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x4a, 0x00}, 0x24,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x4b, 0x00}, 0xd7,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x4c, 0x00}, 0x80,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x43, 0x00}, 0x21,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x4d, 0x00}, 0x00,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x67, 0x00}, 0xc4,                     0x01, i2c_write}, \
-		{MAX96705_CH##ch##_ADDR, {0x07, 0x00}, 0x84,                     0x01, i2c_write}, \
 		{MAX96705_CH##ch##_ADDR, {0x09, 0x00}, ISX016_CH##ch##_MAP_ADDR, 0x01, i2c_write}, \
 		{MAX96705_CH##ch##_ADDR, {0x0A, 0x00}, ISX016_INIT_ADDR,         0x01, i2c_write}, \
 		{MAX96705_CH##ch##_ADDR, {0x0B, 0x00}, MAX96705_ALL_ADDR,        0x01, i2c_write}, \
@@ -264,51 +341,39 @@ static struct reg_val_ops *init_ch[] = {
 	MAX9286_CAMERA_CH3_addr_init_cmd,
 };
 
-#define MAX96705_CROSS_BAR_CH_ADDR_CMD(ch)\
-	static struct reg_val_ops MAX96705_CROSS_BAR_CH##ch##_addr_cmd[] = {\
-		{MAX96705_CH##ch##_ADDR,  {0x20, 0x00}, 0x17,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x21, 0x00}, 0x16,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x22, 0x00}, 0x15,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x23, 0x00}, 0x14,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x24, 0x00}, 0x13,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x25, 0x00}, 0x12,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x26, 0x00}, 0x11,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x27, 0x00}, 0x10,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x28, 0x00}, 0x18,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x29, 0x00}, 0x19,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2a, 0x00}, 0x1a,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2b, 0x00}, 0x1b,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2c, 0x00}, 0x1c,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2d, 0x00}, 0x0d,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2e, 0x00}, 0x0e,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x2f, 0x00}, 0x0f,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x30, 0x00}, 0x07,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x31, 0x00}, 0x06,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x32, 0x00}, 0x05,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x33, 0x00}, 0x04,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x34, 0x00}, 0x03,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x35, 0x00}, 0x02,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x36, 0x00}, 0x01,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x37, 0x00}, 0x00,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x38, 0x00}, 0x08,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x39, 0x00}, 0x09,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x3a, 0x00}, 0x0a,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x3b, 0x00}, 0x0b,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x3c, 0x00}, 0x0c,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x3d, 0x00}, 0x0d,              0x01, i2c_write},	\
-		{MAX96705_CH##ch##_ADDR,  {0x3e, 0x00}, 0x0e,              0x01, i2c_write},	\
-	}
-
-MAX96705_CROSS_BAR_CH_ADDR_CMD(0);
-MAX96705_CROSS_BAR_CH_ADDR_CMD(1);
-MAX96705_CROSS_BAR_CH_ADDR_CMD(2);
-MAX96705_CROSS_BAR_CH_ADDR_CMD(3);
-
-static struct reg_val_ops *cross_bar_ch[] = {
-	MAX96705_CROSS_BAR_CH0_addr_cmd,
-	MAX96705_CROSS_BAR_CH1_addr_cmd,
-	MAX96705_CROSS_BAR_CH2_addr_cmd,
-	MAX96705_CROSS_BAR_CH3_addr_cmd,
+/* video crossbar, the same on every serializer */
+static struct reg_val_ops MAX96705_cross_bar_cmd[] = {
+	{MAX96705_ALL_ADDR, {0x20, 0x00}, 0x17,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x21, 0x00}, 0x16,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x22, 0x00}, 0x15,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x23, 0x00}, 0x14,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x24, 0x00}, 0x13,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x25, 0x00}, 0x12,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x26, 0x00}, 0x11,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x27, 0x00}, 0x10,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x28, 0x00}, 0x18,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x29, 0x00}, 0x19,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2a, 0x00}, 0x1a,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2b, 0x00}, 0x1b,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2c, 0x00}, 0x1c,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2d, 0x00}, 0x0d,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2e, 0x00}, 0x0e,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x2f, 0x00}, 0x0f,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x30, 0x00}, 0x07,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x31, 0x00}, 0x06,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x32, 0x00}, 0x05,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x33, 0x00}, 0x04,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x34, 0x00}, 0x03,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x35, 0x00}, 0x02,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x36, 0x00}, 0x01,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x37, 0x00}, 0x00,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x38, 0x00}, 0x08,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x39, 0x00}, 0x09,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3a, 0x00}, 0x0a,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3b, 0x00}, 0x0b,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3c, 0x00}, 0x0c,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3d, 0x00}, 0x0d,               0x01, i2c_write},
+	{MAX96705_ALL_ADDR, {0x3e, 0x00}, 0x0e,               0x01, i2c_write},
 };
 
 #define MAX9286_CAMERA_TEST_PATTERN(num)\
@@ -331,6 +396,25 @@ struct max9286_datafmt {
 	enum v4l2_colorspace colorspace;
 };
 
+/* register spaces with a regmap cache, see max9286_rmap_descs */
+enum max9286_rmap_id {
+	MAX9286_RMAP_DES,
+	MAX9286_RMAP_SER0,
+	MAX9286_RMAP_SER3 = MAX9286_RMAP_SER0 + 3,
+	MAX9286_RMAP_COUNT,
+};
+
+struct max9286_rmap {
+	struct i2c_client *client;
+	struct regmap *map;
+	u16 slave_addr;
+	/*
+	 * Normally the regmap only shadows writes the driver already put on
+	 * the bus; its own I/O is enabled just for regcache_sync().
+	 */
+	bool live;
+};
+
 struct max9286 {
 	struct v4l2_subdev		subdev;
 	const struct max9286_datafmt	*fmt;
@@ -339,6 +423,40 @@ struct max9286 {
 
 	/* blanking information */
 	u32 link;
+
+	/*
+	 * Every register access goes through xfer_buf under xfer_lock,
+	 * nothing is allocated per transfer. It sits in the kmalloc'ed
+	 * device struct on its own cache line, so it is DMA-safe.
+	 */
+	struct mutex xfer_lock;
+	unsigned long xfer_count;
+	u64 xfer_ns;
+	u8 xfer_buf[MAX9286_XFER_LEN] ____cacheline_aligned;
+	u8 dump_buf[MAX9286_DUMP_LEN] ____cacheline_aligned;
+	/* /dev/max9286_regs: one message pair per read of a batch */
+	struct i2c_msg batch_msg[2 * MAX_REG_BATCH_MAX];
+	u8 batch_buf[MAX_REG_BATCH_MAX * (MAX_REG_LEN + MAX_REG_VAL_LEN)]
+		____cacheline_aligned;
+	struct miscdevice regs_dev;
+	bool regs_registered;
+
+	struct max9286_rmap rmap[MAX9286_RMAP_COUNT];
+	unsigned long cache_elided;
+	/* i2c_poll: how long the polls waited against their timeouts */
+	unsigned long poll_count;
+	unsigned long poll_timeouts;
+	u64 poll_wait_us;
+	u64 poll_budget_us;
+	/* per link: how long its last partial re-init took, see max9286_recover_links */
+	s64 recover_us[SENSOR_MAX_LINK_NUM];
+	/* power-up and programming run in init_work, off the probe path */
+	struct work_struct init_work;
+	struct completion init_done;
+	int init_ret;
+	ktime_t probe_start;
+	/* one max9286_camera_init() at a time: init_work, resume, reinit */
+	struct mutex init_lock;
 };
 
 static const struct max9286_datafmt max9286_colour_fmts[] = {
@@ -376,29 +494,42 @@ static int i2c_delay(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *value)
 {
 	max9286_info("delay %d ms", *value);
-	mdelay(*value);
+	usleep_range(*value * 1000, *value * 1000 + 500);
 
 	return 0;
 }
 
+/* called with xfer_lock held */
+static int max9286_transfer(struct i2c_client *client, struct i2c_msg *msg,
+		int num)
+{
+	struct max9286 *priv = to_max9286(client);
+	u64 start = ktime_get_ns();
+	int ret;
+
+	ret = i2c_transfer(client->adapter, msg, num);
+	priv->xfer_count++;
+	priv->xfer_ns += ktime_get_ns() - start;
+
+	return ret;
+}
+
 static int i2c_read(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val)
 {
-	int ret = 0;
-	u8 *data = NULL;
+	struct max9286 *priv = to_max9286(client);
+	u8 *data = priv->xfer_buf;
 	struct i2c_msg msg[2];
-	unsigned int size = reg_len + 1u;
+	int ret = 0;
 
-	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u)) {
+	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u) ||
+	    (reg_len >= MAX9286_XFER_LEN)) {
 		max9286_err("reg/val/reg_len is %02x/%02x/%d",
 			*reg, *val, reg_len);
 		return -EINVAL;
 	}
 
-	data = kzalloc(size, GFP_KERNEL);
-	if (data == NULL)
-		return -ENOSPC;
-
+	mutex_lock(&priv->xfer_lock);
 	(void)memcpy(data, reg, reg_len);
 	(void)memset(msg, 0, sizeof(msg));
 
@@ -414,35 +545,127 @@ static int i2c_read(struct i2c_client *client, u16 slave_addr,
 
 	client->addr = (slave_addr >> 1);
 
-	ret = i2c_transfer(client->adapter, msg, 2);
+	ret = max9286_transfer(client, msg, 2);
 
 	*val = *(data + reg_len);
-	kfree(data);
-	data = NULL;
+	mutex_unlock(&priv->xfer_lock);
 	max9286_info("read dev/reg/val/ret is %02x/%02x/%02x/%d",
 		slave_addr, *reg, *val, ret);
 
 	return ret;
 }
 
-static int i2c_write(struct i2c_client *client, u16 slave_addr,
+/* count registers from reg on in one auto-increment read */
+static int max9286_read_burst(struct i2c_client *client, u16 slave_addr,
+		u8 reg, u8 *val, unsigned int count)
+{
+	struct max9286 *priv = to_max9286(client);
+	struct i2c_msg msg[2];
+	int ret = 0;
+
+	if ((val == NULL) || (count == 0u) || (count > MAX9286_DUMP_LEN))
+		return -EINVAL;
+
+	mutex_lock(&priv->xfer_lock);
+	priv->xfer_buf[0] = reg;
+	(void)memset(msg, 0, sizeof(msg));
+
+	msg[0].addr = (slave_addr >> 1);
+	msg[0].flags = 0;
+	msg[0].len = 1;
+	msg[0].buf = priv->xfer_buf;
+
+	msg[1].addr = (slave_addr >> 1);
+	msg[1].flags = I2C_M_RD;
+	msg[1].len = (__u16)count;
+	msg[1].buf = priv->dump_buf;
+
+	client->addr = (slave_addr >> 1);
+
+	ret = max9286_transfer(client, msg, 2);
+	if (ret == 2)
+		(void)memcpy(val, priv->dump_buf, count);
+	mutex_unlock(&priv->xfer_lock);
+	max9286_info("read dev/reg/count/ret is %02x/%02x/%u/%d",
+		slave_addr, reg, count, ret);
+
+	return (ret == 2) ? 0 : ((ret < 0) ? ret : -EIO);
+}
+
+/*
+ * Read reg until (value & mask) == (expected & mask), at most timeout_ms.
+ * Read errors count as "not yet": a remote slave does not answer while its
+ * link comes up. Waited time and timeout add up in the i2c_stats node.
+ */
+static int max9286_poll_reg(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 mask, u8 expected,
+		unsigned int timeout_ms)
+{
+	struct max9286 *priv = to_max9286(client);
+	s64 budget_us = (s64)timeout_ms * 1000;
+	ktime_t start = ktime_get();
+	s64 waited_us;
+	u8 val = 0;
+	int ret;
+
+	for (;;) {
+		ret = i2c_read(client, slave_addr, reg, reg_len, &val);
+		waited_us = ktime_us_delta(ktime_get(), start);
+		if ((ret == 2) && ((val & mask) == (expected & mask))) {
+			ret = 0;
+			break;
+		}
+		if (waited_us >= budget_us) {
+			ret = -ETIMEDOUT;
+			break;
+		}
+		usleep_range(MAX9286_POLL_US, MAX9286_POLL_US + 100);
+	}
+
+	priv->poll_count++;
+	priv->poll_wait_us += waited_us;
+	priv->poll_budget_us += budget_us;
+	if (ret < 0)
+		priv->poll_timeouts++;
+	max9286_info("poll dev/reg %02x/%02x: %02x after %lld of %lld us%s",
+		slave_addr, reg[0], val, waited_us, budget_us,
+		(ret < 0) ? ", timed out" : "");
+
+	return ret;
+}
+
+/*
+ * Table op standing in for an i2c_delay of op->timeout ms, so running
+ * into the timeout is not an error. val points into the table entry.
+ */
+static int i2c_poll(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	const struct reg_val_ops *op = container_of(val, struct reg_val_ops, val);
+
+	(void)max9286_poll_reg(client, slave_addr, reg, reg_len, op->mask,
+		*val, op->timeout);
+
+	return 0;
+}
+
+static int max9286_bus_write(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val)
 {
-	u8 *data = NULL;
+	struct max9286 *priv = to_max9286(client);
+	u8 *data = priv->xfer_buf;
 	int ret = 0;
 	struct i2c_msg msg;
 	unsigned int size = reg_len + 1u;
 
-	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u)) {
+	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u) ||
+	    (size > MAX9286_XFER_LEN)) {
 		max9286_err("reg/val/reg_len is %02x/%02x/%d",
 			*reg, *val, reg_len);
 		return -EINVAL;
 	}
 
-	data = kzalloc(size, GFP_KERNEL);
-	if (data == NULL)
-		return -ENOSPC;
-
+	mutex_lock(&priv->xfer_lock);
 	(void)memcpy(data, reg, reg_len);
 	*(data + reg_len) = *val;
 
@@ -453,44 +676,255 @@ static int i2c_write(struct i2c_client *client, u16 slave_addr,
 	msg.buf = data;
 
 	client->addr = (slave_addr >> 1);
-	ret = i2c_transfer(client->adapter, &msg, 1);
+	ret = max9286_transfer(client, &msg, 1);
+	mutex_unlock(&priv->xfer_lock);
 
-	kfree(data);
-	data = NULL;
 	//max9286_info("write dev/reg/val/ret is %02x/%02x/%02x/%d",
 	//	slave_addr, *reg, *val, ret);
 	return ret;
 }
 
+static bool max9286_des_volatile(struct device *dev, unsigned int reg)
+{
+	switch (reg) {
+	case MAX9286_ID_REG:
+	case 0x1B:
+	case MAX9286_LOCK_REG:
+	case 0x28 ... 0x2B:	/* link error counters */
+	case 0x34:
+	case MAX9286_LINK_REG:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool max9286_ser_volatile(struct device *dev, unsigned int reg)
+{
+	return (reg == MAX96705_ADDR_REG) || (reg == MAX9286_ID_REG);
+}
+
+static int max9286_rmap_read(void *context, unsigned int reg,
+		unsigned int *val)
+{
+	struct max9286_rmap *rm = context;
+	u8 addr = (u8)reg;
+	u8 data = 0;
+
+	/* a cache lookup that misses must not turn into a bus read */
+	if (!rm->live)
+		return -EBUSY;
+	if (i2c_read(rm->client, rm->slave_addr, &addr, 1, &data) != 2)
+		return -EIO;
+	*val = data;
+
+	return 0;
+}
+
+static int max9286_rmap_write(void *context, unsigned int reg,
+		unsigned int val)
+{
+	struct max9286_rmap *rm = context;
+	u8 addr = (u8)reg;
+	u8 data = (u8)val;
+
+	if (!rm->live)
+		return 0;
+
+	return (max9286_bus_write(rm->client, rm->slave_addr, &addr, 1,
+		&data) == 1) ? 0 : -EIO;
+}
+
+#define MAX9286_REGMAP_CONFIG(_name, _volatile)			\
+	{								\
+		.name		= _name,				\
+		.reg_bits	= 8,					\
+		.val_bits	= 8,					\
+		.max_register	= 0xff,					\
+		.volatile_reg	= _volatile,				\
+		.reg_read	= max9286_rmap_read,			\
+		.reg_write	= max9286_rmap_write,			\
+		.cache_type	= REGCACHE_RBTREE,			\
+	}
+
+static const struct max9286_rmap_desc {
+	u16 slave_addr;
+	struct regmap_config config;
+} max9286_rmap_descs[MAX9286_RMAP_COUNT] = {
+	[MAX9286_RMAP_DES] = { MAX9286_ADDR,
+		MAX9286_REGMAP_CONFIG("max9286", max9286_des_volatile) },
+	[MAX9286_RMAP_SER0] = { MAX96705_CH0_ADDR,
+		MAX9286_REGMAP_CONFIG("max96705-0", max9286_ser_volatile) },
+	[MAX9286_RMAP_SER0 + 1] = { MAX96705_CH1_ADDR,
+		MAX9286_REGMAP_CONFIG("max96705-1", max9286_ser_volatile) },
+	[MAX9286_RMAP_SER0 + 2] = { MAX96705_CH2_ADDR,
+		MAX9286_REGMAP_CONFIG("max96705-2", max9286_ser_volatile) },
+	[MAX9286_RMAP_SER3] = { MAX96705_CH3_ADDR,
+		MAX9286_REGMAP_CONFIG("max96705-3", max9286_ser_volatile) },
+};
+
+static int max9286_regmap_init(struct i2c_client *client)
+{
+	struct max9286 *priv = to_max9286(client);
+	struct max9286_rmap *rm;
+	int i;
+
+	for (i = 0; i < MAX9286_RMAP_COUNT; ++i) {
+		rm = &priv->rmap[i];
+		rm->client = client;
+		rm->slave_addr = max9286_rmap_descs[i].slave_addr;
+		rm->map = devm_regmap_init(&client->dev, NULL, rm,
+			&max9286_rmap_descs[i].config);
+		if (IS_ERR(rm->map)) {
+			max9286_err("regmap %s: %ld",
+				max9286_rmap_descs[i].config.name, PTR_ERR(rm->map));
+			return PTR_ERR(rm->map);
+		}
+	}
+
+	return 0;
+}
+
+static struct max9286_rmap *max9286_rmap_find(struct max9286 *priv,
+		u16 slave_addr, unsigned int reg_len)
+{
+	int i;
+
+	if (reg_len != 1u)
+		return NULL;
+	for (i = 0; i < MAX9286_RMAP_COUNT; ++i)
+		if ((priv->rmap[i].map != NULL) &&
+		    (priv->rmap[i].slave_addr == slave_addr))
+			return &priv->rmap[i];
+
+	return NULL;
+}
+
+/* forget what the caches first..last hold, the devices were reset */
+static void max9286_cache_drop(struct max9286 *priv, int first, int last)
+{
+	for (; first <= last; ++first)
+		if (priv->rmap[first].map != NULL)
+			(void)regcache_drop_region(priv->rmap[first].map, 0,
+				max9286_rmap_descs[first].config.max_register);
+}
+
+/* keeps the caches in step with a write that reached the bus */
+static void max9286_cache_update(struct max9286 *priv, u16 slave_addr,
+		unsigned int reg, unsigned int reg_len, u8 val)
+{
+	struct max9286_rmap *rm = max9286_rmap_find(priv, slave_addr, reg_len);
+	int id;
+
+	if (rm != NULL) {
+		id = rm - priv->rmap;
+		/* a serializer moved to another address */
+		if ((id != MAX9286_RMAP_DES) && (reg == MAX96705_ADDR_REG))
+			max9286_cache_drop(priv, id, id);
+		else
+			(void)regmap_write(rm->map, reg, val);
+		return;
+	}
+
+	/*
+	 * 0x80 is whichever serializers the deserializer currently forwards
+	 * to, and the PoC switch may power cycle them all.
+	 */
+	if ((slave_addr == MAX96705_ALL_ADDR) || (slave_addr == MAX20088_ADDR))
+		max9286_cache_drop(priv, MAX9286_RMAP_SER0, MAX9286_RMAP_SER3);
+}
+
+/* pushes the cache out through the regmap, used after a power loss */
+static int max9286_cache_sync(struct max9286_rmap *rm)
+{
+	int ret;
+
+	rm->live = true;
+	ret = regcache_sync(rm->map);
+	rm->live = false;
+
+	return ret;
+}
+
+static int i2c_write(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	struct max9286 *priv = to_max9286(client);
+	struct max9286_rmap *rm = NULL;
+	unsigned int cur;
+	int ret;
+
+	if (cache_writes != 0)
+		rm = max9286_rmap_find(priv, slave_addr, reg_len);
+	/* volatile registers miss: the shadow regmap never reads the bus */
+	if ((rm != NULL) && (regmap_read(rm->map, *reg, &cur) == 0) &&
+	    (cur == *val)) {
+		priv->cache_elided++;
+		return 1;
+	}
+
+	ret = max9286_bus_write(client, slave_addr, reg, reg_len, val);
+	if (ret == 1)
+		max9286_cache_update(priv, slave_addr, *reg, reg_len, *val);
+
+	return ret;
+}
+
+/*
+ * For writes from user space: always to the bus, the hardware may have
+ * changed behind the cache. The cache still follows.
+ */
+static int max9286_write_through(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	int ret;
+
+	ret = max9286_bus_write(client, slave_addr, reg, reg_len, val);
+	if (ret == 1)
+		max9286_cache_update(to_max9286(client), slave_addr, *reg,
+			reg_len, *val);
+
+	return ret;
+}
+
 int i2c_write_t(struct i2c_client *client,u16 slave_addr, u8 *addr, u16 *val)
 {
+	struct max9286 *priv = to_max9286(client);
+	u8 *buf = priv->xfer_buf;
+	struct i2c_msg msg;
 	int ret;
-	u8 buf[3] = { *addr & 0xff, *val >> 8, *val & 0xff };
+
+	mutex_lock(&priv->xfer_lock);
+	buf[0] = *addr & 0xff;
+	buf[1] = *val >> 8;
+	buf[2] = *val & 0xff;
 	client->addr = (slave_addr >> 1);
-	ret = i2c_master_send(client, buf, 3);
+	msg.addr = client->addr;
+	msg.flags = 0;
+	msg.len = 3;
+	msg.buf = buf;
+	ret = max9286_transfer(client, &msg, 1);
+	mutex_unlock(&priv->xfer_lock);
 	debug("i2c_write: slave:%02x 0x%02x : 0x%04x\n",client->addr,*addr, *val);
-	return ret == 3 ? 0 : ret;
+	return ret == 1 ? 0 : ret;
 }
 
 int i2c_read_t(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u16 *val)
 {
-	int ret = 0;
-	u8 *data = NULL;
+	struct max9286 *priv = to_max9286(client);
+	u8 *data = priv->xfer_buf;
 	struct i2c_msg msg[2];
-	u8 rbuf[2];
-	unsigned int size = reg_len + 1u;
+	int ret = 0;
 
-	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u)) {
+	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u) ||
+	    (reg_len + 2u > MAX9286_XFER_LEN)) {
 		max9286_err("reg/val/reg_len is %02x/%02x/%d",
 			*reg, *val, reg_len);
 		return -EINVAL;
 	}
 
-	data = kzalloc(size, GFP_KERNEL);
-	if (data == NULL)
-		return -ENOSPC;
-
+	mutex_lock(&priv->xfer_lock);
 	(void)memcpy(data, reg, reg_len);
 	(void)memset(msg, 0, sizeof(msg));
 
@@ -502,16 +936,15 @@ int i2c_read_t(struct i2c_client *client, u16 slave_addr,
 	msg[1].addr = (slave_addr >> 1);
 	msg[1].flags = I2C_M_RD;
 	msg[1].len = 2;
-	msg[1].buf = rbuf;
+	msg[1].buf = data + reg_len;
 
 	client->addr = (slave_addr >> 1);
 
-	ret = i2c_transfer(client->adapter, msg, 2);
-	*val = be16_to_cpu(*((__be16 *)rbuf));
+	ret = max9286_transfer(client, msg, 2);
+	*val = (data[reg_len] << 8) | data[reg_len + 1];
+	debug("rbuf[0]=%02x,rbuf[1]=%02x\n",data[reg_len],data[reg_len + 1]);
+	mutex_unlock(&priv->xfer_lock);
 	debug("0x%02X : 0x%04x\n", *reg, *val);
-	debug("rbuf[0]=%02x,rbuf[1]=%02x\n",rbuf[0],rbuf[1]);
-	kfree(data);
-	data = NULL;
 	max9286_info("read dev/reg/val/ret is %02x/%02x/%04x/%d",
 		slave_addr, *reg, *val, ret);
 
@@ -561,27 +994,6 @@ static int max9286_write_array(struct i2c_client *client,
 	return 0;
 }
 
-static int max9286_get_lock_status(struct i2c_client *client, u8 *val)
-{
-	int ret = 0;
-	u8 lock_reg = MAX9286_LOCK_REG;
-
-	ret = i2c_read(client, MAX9286_ADDR, &lock_reg, 1, val);
-	if (ret != 2) {
-		max9286_err("ret=%d", ret);
-		return -EIO;
-	}
-
-	if ((*val & (u8)0x80) != 0u) {
-		max9286_info("camera links are locked");
-	} else {
-		max9286_err("camera links are not locked");
-		ret =  -ENODEV;
-	}
-
-	return ret;
-}
-
 static int max9286_get_link(struct i2c_client *client, u8 *val)
 {
 	int ret = 0;
@@ -596,7 +1008,12 @@ static int max9286_get_link(struct i2c_client *client, u8 *val)
 	return ret;
 }
 
-static int max9286_camera_has_init(struct i2c_client *client, u8 *link_reg_val)
+/*
+ * 0: every linked serializer still answers at its remapped address,
+ * 1: none does, 2: only some, *lost has the links that lost their setup.
+ */
+static int max9286_camera_has_init(struct i2c_client *client, u8 *link_reg_val,
+	u8 *lost)
 {
 	unsigned long len = ARRAY_SIZE(MAX9286_camera_r_cmd);
 	struct reg_val_ops *cmd = MAX9286_camera_r_cmd;
@@ -604,10 +1021,9 @@ static int max9286_camera_has_init(struct i2c_client *client, u8 *link_reg_val)
 	int ret = 0;
 	u8 val = 0U;
 	u8 count = 0U;
-	u8 reg_addr[2] = {0x00U};
-	u8 reg_value = 0x00U;
 	struct max9286 *priv = NULL;
 
+	*lost = 0U;
 	max9286_info("in max9286_camera_has_init, link_reg_val is 0x%x\n",
 		*link_reg_val);
 	for (index = 0; index < len; ++index) {
@@ -618,6 +1034,7 @@ static int max9286_camera_has_init(struct i2c_client *client, u8 *link_reg_val)
 			cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
 		if (ret < 0) {
 			max9286_info("channel %lu has reseted\n", index);
+			*lost |= (u8)(0x01U << index);
 		} else {
 			count++;
 			max9286_info("channel %lu keep last setting\n", index);
@@ -632,28 +1049,39 @@ static int max9286_camera_has_init(struct i2c_client *client, u8 *link_reg_val)
 		max9286_info("all channel has reseted, will initialize again\n");
 		ret = 1;
 	} else {
-		max9286_info("some of channel has reseted, will set all channel address to 0x80\n");
-		for (index = 0; index < len; ++index) {
-			if (((*link_reg_val >> index) & 0x01) == 0x00U)
-				continue;
-
-			reg_value = MAX96705_INIT_ADDR;
-			reg_addr[0] = 0x00U;
-			ret = i2c_write(client, ch_addr[index],
-				reg_addr, 0x01, &reg_value);
-			if (ret < 0) {
-				max9286_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
-					cmd[index].slave_addr,
-					cmd[index].reg[0],
-					cmd[index].val, ret, index);
-				return ret;
-			}
-		}
+		max9286_info("channel 0x%x of 0x%x has reseted\n", *lost,
+			*link_reg_val);
 		ret = 2;
 	}
 	return ret;
 }
 
+/* back to the power-on address, for a full init; lost links are there already */
+static int max9286_reset_ch_addr(struct i2c_client *client, u8 *link_reg_val,
+	u8 lost)
+{
+	u8 reg_addr[2] = {0x00U};
+	u8 reg_value = MAX96705_INIT_ADDR;
+	unsigned long index = 0UL;
+	int ret = 0;
+
+	for (index = 0; index < SENSOR_MAX_LINK_NUM; ++index) {
+		if ((((*link_reg_val & ~lost) >> index) & 0x01) == 0x00U)
+			continue;
+
+		ret = i2c_write(client, ch_addr[index],
+			reg_addr, 0x01, &reg_value);
+		if (ret < 0) {
+			max9286_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
+				ch_addr[index], reg_addr[0], reg_value,
+				ret, index);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 static int set_output_order(struct i2c_client *client, u8 *link_reg_val)
 {
 	int ret = 0;
@@ -762,19 +1190,119 @@ static int max9286_camera_ch_addr_init(struct i2c_client *client,
 	return 0;
 }
 
-static int max96705_cross_bar_ch_addr_init(struct i2c_client *client,
-	struct reg_val_ops *cmd, unsigned long len, int ch)
+/* cmd as in the table, but sent to slave_addr */
+static int max96705_write_array_at(struct i2c_client *client,
+	const struct reg_val_ops *cmd, unsigned long len, u16 slave_addr)
 {
+	struct reg_val_ops op;
+	unsigned long index = 0;
 	int ret = 0;
 
-	ret = max9286_write_array(client, cmd, len);
+	for (; index < len; ++index) {
+		op = cmd[index];
+		ret = op.i2c_ops(client, slave_addr, op.reg, op.reg_len, &op.val);
+		if (ret < 0) {
+			max9286_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
+				slave_addr, op.reg[0], op.val, ret, index);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * The link independent serializer settings, to slave_addr: either
+ * MAX96705_ALL_ADDR before the remap or one remapped serializer.
+ */
+static int max96705_common_init(struct i2c_client *client, u16 slave_addr)
+{
+	int ret = 0;
+
+	ret = max96705_write_array_at(client, MAX96705_common_init_cmd,
+		ARRAY_SIZE(MAX96705_common_init_cmd), slave_addr);
 	if (ret < 0) {
-		max9286_err("max96705 cross bar init failed\n");
+		max9286_err("max96705 %x init failed\n", slave_addr);
+		return -1;
+	}
+
+	ret = max96705_write_array_at(client, MAX96705_cross_bar_cmd,
+		ARRAY_SIZE(MAX96705_cross_bar_cmd), slave_addr);
+	if (ret < 0) {
+		max9286_err("max96705 %x cross bar init failed\n", slave_addr);
 		return -1;
 	}
 	return 0;
 }
 
+/*
+ * Re-init only the links in lost, whose serializer came back at its
+ * power-on address, while the others keep streaming. The forward control
+ * channel is open to the lost links only: the healthy serializers also
+ * answer at MAX96705_ALL_ADDR and must not see any of this.
+ */
+static int max9286_recover_links(struct i2c_client *client, u8 *link_reg_val,
+	u8 lost)
+{
+	struct max9286 *priv = to_max9286(client);
+	ktime_t start = ktime_get();
+	u8 reg_addr[2] = {0x00U, 0x00U};
+	u8 reg_value = 0x00U;
+	int ret = 0;
+	u8 i = 0;
+
+	reg_addr[0] = MAX9286_F_R_CTL_REG_ADDR;
+	reg_value = lost | 0xF0;
+	ret = i2c_write(client, MAX9286_ADDR, reg_addr, 0x01U, &reg_value);
+	if (ret < 0)
+		return ret;
+
+	ret = max9286_write_array(client, MAX96705_link_recover_cmd,
+		ARRAY_SIZE(MAX96705_link_recover_cmd));
+	if (ret == 0) {
+		/* like i2c_poll: running into the timeout is not an error */
+		reg_addr[0] = MAX9286_LINK_REG;
+		(void)max9286_poll_reg(client, MAX9286_ADDR, reg_addr, 1,
+			(u8)(lost << 4), (u8)(lost << 4), 5);
+		ret = max9286_write_array(client, MAX96705_link_recover_cfg_cmd,
+			ARRAY_SIZE(MAX96705_link_recover_cfg_cmd));
+	}
+	if (ret == 0)
+		ret = max96705_common_init(client, MAX96705_ALL_ADDR);
+
+	for (i = 0; (ret >= 0) && (i < SENSOR_MAX_LINK_NUM); i++) {
+		if (((lost >> i) & 0x01U) == 0x00U)
+			continue;
+		ret = max9286_camera_ch_addr_init(client, init_ch[i],
+			ARRAY_SIZE(MAX9286_CAMERA_CH0_addr_init_cmd), i);
+		if (ret < 0)
+			break;
+
+		/* serial link back on, then wait for its video */
+		reg_addr[0] = 0x04;
+		reg_value = 0x83;
+		ret = i2c_write(client, ch_addr[i], reg_addr, 0x01U, &reg_value);
+		if (ret < 0)
+			break;
+		reg_addr[0] = MAX9286_LINK_REG;
+		if (max9286_poll_reg(client, MAX9286_ADDR, reg_addr, 1,
+				(u8)(0x01U << i), (u8)(0x01U << i), 20) < 0)
+			max9286_err("link %u: no video after re-init", i);
+
+		priv->recover_us[i] = ktime_us_delta(ktime_get(), start);
+		max9286_info("link %u recovered in %lld us", i,
+			priv->recover_us[i]);
+	}
+
+	reg_addr[0] = MAX9286_F_R_CTL_REG_ADDR;
+	reg_value = *link_reg_val | 0xF0;
+	if ((i2c_write(client, MAX9286_ADDR, reg_addr, 0x01U, &reg_value) < 0) &&
+	    (ret >= 0))
+		ret = -EIO;
+
+	return (ret < 0) ? ret : 0;
+}
+
 static int camera_module_init(struct i2c_client *client, u8 *link_reg_val)
 {
 	int ret = 0;
@@ -782,12 +1310,25 @@ static int camera_module_init(struct i2c_client *client, u8 *link_reg_val)
 	u8 reg_value = 0x0U;
 	u8 cam_count = 0U;
 	u8 i = 0;
+	struct max9286 *priv = to_max9286(client);
+	unsigned long xfers = 0;
+	u8 lost = 0U;
 
-	ret  = max9286_camera_has_init(client, link_reg_val);
+	ret  = max9286_camera_has_init(client, link_reg_val, &lost);
 	if (ret == 0) {
 		max9286_info("max9286 and camera have been initialized");
 		return 0;
 	}
+	if (ret == 2) {
+		ret = max9286_recover_links(client, link_reg_val, lost);
+		if (ret == 0)
+			return 0;
+		max9286_err("re-init of links 0x%x failed (%d), will initialize all again",
+			lost, ret);
+		ret = max9286_reset_ch_addr(client, link_reg_val, lost);
+		if (ret < 0)
+			return ret;
+	}
 	ret = max9286_write_array(client,
 		MAX9286_camera_pre_init_cmd,
 		ARRAY_SIZE(MAX9286_camera_pre_init_cmd));
@@ -875,6 +1416,14 @@ static int camera_module_init(struct i2c_client *client, u8 *link_reg_val)
 		return ret;
 	}
 
+	xfers = priv->xfer_count;
+	if (broadcast_init != 0) {
+		max9286_info("init all linked max96705 through 0x%x", MAX96705_ALL_ADDR);
+		ret = max96705_common_init(client, MAX96705_ALL_ADDR);
+		if (ret < 0)
+			return ret;
+	}
+
 	for (i = 0; i < SENSOR_MAX_LINK_NUM; i++) {
 		if (((*link_reg_val >> i) & 0x01U) == 0x01U) {
 			max9286_info("channel %d linked, will init it", i);
@@ -883,14 +1432,16 @@ static int camera_module_init(struct i2c_client *client, u8 *link_reg_val)
 					i);
 			if (ret < 0)
 				return ret;
+			if (broadcast_init != 0)
+				continue;
 			max9286_info("channel %d linked, will init cross bar at max96705", i);
-			ret = max96705_cross_bar_ch_addr_init(client, cross_bar_ch[i],
-				ARRAY_SIZE(MAX96705_CROSS_BAR_CH0_addr_cmd), i);
+			ret = max96705_common_init(client, ch_addr[i]);
 			if (ret < 0)
 				return ret;
-				
-			}
+		}
 	}
+	max9286_info("%u max96705 programmed in %lu i2c transfers",
+		cam_count, priv->xfer_count - xfers);
 
 	reg_addr[0] = MAX9286_F_R_CTL_REG_ADDR;
 	reg_value = *link_reg_val | 0xF0;
@@ -914,14 +1465,14 @@ static int max9286_camera_init(struct i2c_client *client)
 {
 	int ret = 0;
 	u8 max9286_id_val = 0;
-	u8 lock_reg_val = 0;
+	u8 lock_reg = 0;
 	u8 link_reg_val = 0;
 	int index = 0;
 	int read_cnt = 0;
 	int retry_num = 3;
 	u32 link_cnt = 0;
 	struct max9286 *priv = NULL;
-	u64 delay = 10000;
+	unsigned long delay = 10000;
 
     debug("%s:%d\n",__func__,__LINE__);
 	/*MAX9286 ID confirm*/
@@ -935,7 +1486,7 @@ static int max9286_camera_init(struct i2c_client *client)
 			return -EIO;
 		}
 
-		udelay(delay);
+		usleep_range(delay, delay + 1000);
 	}
 
 	/*check video link*/
@@ -952,7 +1503,7 @@ static int max9286_camera_init(struct i2c_client *client)
 			return -ENODEV;
 		}
 
-		udelay(delay);
+		usleep_range(delay, delay + 1000);
 	}
 
 	//show max9286 link information
@@ -973,18 +1524,13 @@ static int max9286_camera_init(struct i2c_client *client)
 		return ret;
 	}
 
-	/* check camera links are locked or not */
-	for (read_cnt = 0; read_cnt < 3; ++read_cnt) {
-		ret = max9286_get_lock_status(client, &lock_reg_val);
-		if (ret == 2)
-			break;
-
-		if (read_cnt == 2) {
-			max9286_err("read lock status time out");
-			return -EIO;
-		}
-
-		udelay(delay);
+	/* check camera links are locked, within the 20 ms the retries took */
+	lock_reg = MAX9286_LOCK_REG;
+	ret = max9286_poll_reg(client, MAX9286_ADDR, &lock_reg, 1,
+		MAX9286_LOCKED, MAX9286_LOCKED, 20);
+	if (ret < 0) {
+		max9286_err("camera links are not locked");
+		return -EIO;
 	}
 
 	priv = to_max9286(client);
@@ -999,6 +1545,14 @@ static int max9286_camera_init(struct i2c_client *client)
 	return 0;
 }
 
+/* anything that needs the chain programmed waits for init_work first */
+static int max9286_wait_ready(struct max9286 *priv)
+{
+	int ret = wait_for_completion_interruptible(&priv->init_done);
+
+	return (ret < 0) ? ret : priv->init_ret;
+}
+
 static int max9286_g_mbus_config(struct v4l2_subdev *sd,
 				struct v4l2_mbus_config *cfg)
 {
@@ -1010,7 +1564,9 @@ static int max9286_g_mbus_config(struct v4l2_subdev *sd,
 
 static int max9286_s_stream(struct v4l2_subdev *sd, int enable)
 {
-	return 0;
+	struct i2c_client *client = v4l2_get_subdevdata(sd);
+
+	return (enable != 0) ? max9286_wait_ready(to_max9286(client)) : 0;
 }
 
 static int max9286_s_mbus_config(struct v4l2_subdev *sd,
@@ -1105,6 +1661,10 @@ static int max9286_set_fmt(struct v4l2_subdev *sd,
     if (format->pad != 0u)
         return -EINVAL;
     	debug("------->>>>in\n");
+	/* priv->link is only known once the chain has been probed */
+	ret = max9286_wait_ready(priv);
+	if (ret < 0)
+		return ret;
 	if (fmt == NULL) {
 		/* MIPI CSI could have changed the format, double-check */
 		if (format->which == (__u32)V4L2_SUBDEV_FORMAT_ACTIVE)
@@ -1181,36 +1741,52 @@ static int max9286_set_fmt(struct v4l2_subdev *sd,
 	return ret;
 }
 
+/*
+ * Plain register accesses, nothing else is touched. reg bits 7:0 are the
+ * register, bits 15:8 the 8 bit address of a slave behind the MAX9286
+ * (0 for the MAX9286 itself).
+ */
+static u16 max9286_dbg_slave(const struct v4l2_dbg_register *reg)
+{
+	u16 slave_addr = (u16)((reg->reg >> 8) & 0xFFU);
+
+	return (slave_addr != 0u) ? slave_addr : MAX9286_ADDR;
+}
+
 static int max9286_g_register(struct v4l2_subdev *sd,
 		struct v4l2_dbg_register *reg)
 {
-    struct i2c_client *client = v4l2_get_subdevdata(sd);
-    int ret = 0;
-    u8 val = 0;
-    u8 max9286_reg = (u8)(reg->reg);
-    debug("-----> in \n");
-    if (reg == NULL){
-        max9286_err("reg is NULL!!!\n");
-        return -EINVAL;
-    }
+	struct i2c_client *client = v4l2_get_subdevdata(sd);
+	u8 val = 0;
+	int ret = 0;
 
-    ret =  max9286_camera_init(client);
-    if (ret < 0){
-        max9286_err("%s --->>> %d\n",__func__,__LINE__);
-        return ret;
-    }
+	if (reg->match.type != (u8)0)
+		return -EINVAL;
 
-	max9286_info("read max9286 reg %llx", reg->reg);
-	if (reg->match.type == (u8)0) {
-		ret = i2c_read(client, MAX9286_ADDR, &max9286_reg, 1, &val);
-		if (ret != 2) {
-			max9286_err("ret=%d", ret);
-			return -EIO;
-		}
-		reg->val = val;
-	}
+	ret = max9286_read_burst(client, max9286_dbg_slave(reg), (u8)reg->reg,
+		&val, 1);
+	if (ret < 0)
+		return ret;
 
-	return ret;
+	reg->val = val;
+	reg->size = 1;
+	return 0;
+}
+
+static int max9286_s_register(struct v4l2_subdev *sd,
+		const struct v4l2_dbg_register *reg)
+{
+	struct i2c_client *client = v4l2_get_subdevdata(sd);
+	u8 addr = (u8)reg->reg;
+	u8 val = (u8)reg->val;
+	int ret = 0;
+
+	if (reg->match.type != (u8)0)
+		return -EINVAL;
+
+	ret = max9286_write_through(client, max9286_dbg_slave(reg), &addr, 1,
+		&val);
+	return (ret < 0) ? ret : 0;
 }
 
 static const struct v4l2_subdev_video_ops max9286_subdev_video_ops = {
@@ -1222,6 +1798,7 @@ static const struct v4l2_subdev_video_ops max9286_subdev_video_ops = {
 static const struct v4l2_subdev_core_ops max9286_subdev_core_ops = {
 	.s_power	= max9286_s_power,
 	.g_register	= max9286_g_register,
+	.s_register	= max9286_s_register,
 };
 
 static const struct v4l2_subdev_pad_ops max9286_subdev_pad_ops = {
@@ -1310,6 +1887,10 @@ err_vdd1v8:
 
 #define sensor_register_debug
 #ifdef sensor_register_debug
+/*
+ * register_addr selects the register for the register_* nodes below, for
+ * all readers at once; new tools use /dev/max9286_regs instead.
+ */
 static struct i2c_client *sensor_client = NULL;
 static u16 data_t;
 static u8 data;
@@ -1328,7 +1909,6 @@ static ssize_t addr_store(struct device *dev, struct device_attribute *attr, con
     return count;
 }
 //for max20088
-#define MAX20088_ADDR 0x50 //0x28
 static ssize_t register_show_max20088(struct device *dev, struct device_attribute *attr, char *buf)
 {
     addr[0] = addr[1];
@@ -1366,16 +1946,259 @@ static ssize_t register_store_temp(struct device *dev, struct device_attribute *
     debug("luozh: addr=0x%02x, data=0x%04x\n", addr[0], data_t);
     return count;
 }
+static ssize_t i2c_stats_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+    struct max9286 *priv = to_max9286(sensor_client);
+    unsigned long count;
+    u64 ns;
+
+    mutex_lock(&priv->xfer_lock);
+    count = priv->xfer_count;
+    ns = priv->xfer_ns;
+    mutex_unlock(&priv->xfer_lock);
+
+    return sprintf(buf, "xfers=%lu avg_ns=%llu\ncache_writes=%d elided=%lu\n"
+            "polls=%lu timeouts=%lu waited_us=%llu budget_us=%llu\n"
+            "recover_us=%lld,%lld,%lld,%lld\n",
+            count, count ? div64_u64(ns, count) : 0ULL,
+            cache_writes, priv->cache_elided,
+            priv->poll_count, priv->poll_timeouts,
+            priv->poll_wait_us, priv->poll_budget_us,
+            priv->recover_us[0], priv->recover_us[1],
+            priv->recover_us[2], priv->recover_us[3]);
+}
+/*
+ * register_dump: the file offset is the register, bits 15:8 the 8 bit
+ * address of the slave (0 for the MAX9286 itself), as in
+ * VIDIOC_DBG_G_REGISTER. A read stays within one slave and is one
+ * auto-increment burst, e.g. the serializer on link 0 at 0x82:
+ *   dd if=register_dump bs=256 skip=$((0x82)) count=1 | xxd
+ * Slaves with 8 bit register addresses only.
+ */
+static ssize_t register_dump_read(struct file *filp, struct kobject *kobj,
+        struct bin_attribute *attr, char *buf, loff_t off, size_t count)
+{
+    u16 slave = (u16)((off >> 8) & 0xFFu);
+    u8 reg = (u8)off;
+    int ret;
+
+    count = min_t(size_t, count, MAX9286_DUMP_LEN - reg);
+    if (slave == 0u)
+        slave = MAX9286_ADDR;
+    ret = max9286_read_burst(sensor_client, slave, reg, (u8 *)buf, count);
+    return (ret < 0) ? ret : (ssize_t)count;
+}
+/* reinit: any write re-runs the link check, re-initializing lost links */
+static ssize_t reinit_store(struct device *dev, struct device_attribute *attr, const char *buf, size_t count)
+{
+    struct max9286 *priv = to_max9286(sensor_client);
+    int ret;
+
+    flush_work(&priv->init_work);
+    mutex_lock(&priv->init_lock);
+    ret = max9286_camera_init(sensor_client);
+    priv->init_ret = (ret < 0) ? ret : 0;
+    mutex_unlock(&priv->init_lock);
+    return (ret < 0) ? ret : count;
+}
 static DEVICE_ATTR(register_addr, 0644, addr_show, addr_store);
+static BIN_ATTR_RO(register_dump, 0x10000);
+static DEVICE_ATTR(reinit, 0200, NULL, reinit_store);
+static DEVICE_ATTR(i2c_stats, 0444, i2c_stats_show, NULL);
 static DEVICE_ATTR(android_register_max20088, 0644, register_show_max20088, register_store_max20088);
 static DEVICE_ATTR(android_register_temp102, 0644, register_show_temp, register_store_temp);
 #endif
+/*
+ * /dev/max9286_regs, see max_reg_batch.h. Writes always reach the bus,
+ * one register at a time, and the shadow caches follow them, see
+ * max9286_write_through(); a run of reads shares one i2c_transfer(). All
+ * state lives in the request.
+ */
+static int max9286_batch_check(const struct max_reg_access *acc)
+{
+	if (((acc->op != MAX_REG_OP_READ) && (acc->op != MAX_REG_OP_WRITE)) ||
+	    (acc->reg_len == 0u) || (acc->reg_len > MAX_REG_LEN) ||
+	    (acc->len == 0u) || (acc->len > MAX_REG_VAL_LEN))
+		return -EINVAL;
+
+	return 0;
+}
+
+static u16 max9286_batch_slave(const struct max_reg_access *acc)
+{
+	return (acc->slave == 0u) ? MAX9286_ADDR : acc->slave;
+}
+
+static void max9286_batch_reg(const struct max_reg_access *acc, u16 reg,
+		u8 *buf)
+{
+	if (acc->reg_len == 2u) {
+		buf[0] = (u8)(reg >> 8);
+		buf[1] = (u8)reg;
+	} else {
+		buf[0] = (u8)reg;
+	}
+}
+
+static int max9286_batch_write(struct i2c_client *client,
+		struct max_reg_access *acc)
+{
+	u8 reg[MAX_REG_LEN];
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < acc->len; i++) {
+		max9286_batch_reg(acc, acc->reg + i, reg);
+		ret = max9286_write_through(client, max9286_batch_slave(acc), reg,
+			acc->reg_len, &acc->val[i]);
+		if (ret != 1)
+			return (ret < 0) ? ret : -EIO;
+	}
+
+	return 0;
+}
+
+/* acc[0..n) are checked reads */
+static void max9286_batch_read(struct i2c_client *client,
+		struct max_reg_access *acc, unsigned int n)
+{
+	struct max9286 *priv = to_max9286(client);
+	struct i2c_msg *msg = priv->batch_msg;
+	u8 *buf = priv->batch_buf;
+	unsigned int i;
+	int ret;
+
+	mutex_lock(&priv->xfer_lock);
+	(void)memset(msg, 0, 2u * n * sizeof(*msg));
+	for (i = 0; i < n; i++) {
+		max9286_batch_reg(&acc[i], acc[i].reg, buf);
+		msg[2u * i].addr = max9286_batch_slave(&acc[i]) >> 1;
+		msg[2u * i].flags = 0;
+		msg[2u * i].len = acc[i].reg_len;
+		msg[2u * i].buf = buf;
+		msg[2u * i + 1u].addr = msg[2u * i].addr;
+		msg[2u * i + 1u].flags = I2C_M_RD;
+		msg[2u * i + 1u].len = acc[i].len;
+		msg[2u * i + 1u].buf = buf + MAX_REG_LEN;
+		buf += MAX_REG_LEN + MAX_REG_VAL_LEN;
+	}
+
+	ret = max9286_transfer(client, msg, (int)(2u * n));
+	if (ret == (int)(2u * n)) {
+		for (i = 0; i < n; i++) {
+			(void)memcpy(acc[i].val, msg[2u * i + 1u].buf, acc[i].len);
+			acc[i].result = 0;
+		}
+	}
+	mutex_unlock(&priv->xfer_lock);
+
+	if (ret == (int)(2u * n))
+		return;
+	/* the transfer stops at the first slave not answering: find it */
+	if (n > 1u) {
+		for (i = 0; i < n; i++)
+			max9286_batch_read(client, &acc[i], 1);
+		return;
+	}
+	acc->result = (s16)((ret < 0) ? ret : -EIO);
+}
+
+static long max9286_regs_ioctl(struct file *file, unsigned int cmd,
+		unsigned long arg)
+{
+	struct max9286 *priv = container_of(file->private_data,
+		struct max9286, regs_dev);
+	struct i2c_client *client = v4l2_get_subdevdata(&priv->subdev);
+	void __user *uarg = (void __user *)arg;
+	struct max_reg_batch batch;
+	struct max_reg_access *acc;
+	void __user *uacc;
+	u32 i, n;
+	long ret = 0;
+
+	if (cmd != MAX_REG_IOC_BATCH)
+		return -ENOTTY;
+	if (copy_from_user(&batch, uarg, sizeof(batch)) != 0u)
+		return -EFAULT;
+	if ((batch.count == 0u) || (batch.count > MAX_REG_BATCH_MAX))
+		return -EINVAL;
+
+	uacc = (void __user *)(uintptr_t)batch.accesses;
+	acc = memdup_user(uacc, batch.count * sizeof(*acc));
+	if (IS_ERR(acc))
+		return PTR_ERR(acc);
+
+	for (i = 0; i < batch.count; i += n) {
+		n = 1;
+		acc[i].result = (s16)max9286_batch_check(&acc[i]);
+		if (acc[i].result != 0)
+			continue;
+		if (acc[i].op == MAX_REG_OP_WRITE) {
+			acc[i].result = (s16)max9286_batch_write(client, &acc[i]);
+			continue;
+		}
+		while ((i + n < batch.count) &&
+		       (acc[i + n].op == MAX_REG_OP_READ) &&
+		       (max9286_batch_check(&acc[i + n]) == 0))
+			n++;
+		max9286_batch_read(client, &acc[i], n);
+	}
+
+	batch.failed = 0;
+	for (i = 0; i < batch.count; i++) {
+		if (acc[i].result != 0)
+			batch.failed++;
+	}
+	if ((copy_to_user(uacc, acc, batch.count * sizeof(*acc)) != 0u) ||
+	    (copy_to_user(uarg, &batch, sizeof(batch)) != 0u))
+		ret = -EFAULT;
+	kfree(acc);
+
+	return ret;
+}
+
+static const struct file_operations max9286_regs_fops = {
+	.owner = THIS_MODULE,
+	.unlocked_ioctl = max9286_regs_ioctl,
+	/* struct max_reg_batch has the same layout for 32 bit callers */
+	.compat_ioctl = max9286_regs_ioctl,
+};
+
+/*
+ * Runs after probe has registered the subdev: powers the chain up, waits
+ * for it to settle and programs it. Whatever needs the cameras waits for
+ * init_done, see max9286_wait_ready().
+ */
+static void max9286_init_work(struct work_struct *work)
+{
+	struct max9286 *priv = container_of(work, struct max9286, init_work);
+	struct i2c_client *client = v4l2_get_subdevdata(&priv->subdev);
+	int ret;
+
+	ret = pinctrl_select_state(max9286_pctrl.pinctrl, max9286_pctrl.gpio_state_active);
+	if (ret == 0) {
+		msleep(500);
+		mutex_lock(&priv->init_lock);
+		ret = max9286_camera_init(client);
+		mutex_unlock(&priv->init_lock);
+	}
+	if (ret < 0) {
+		max9286_err("camera init failed %d", ret);
+		if (max9286_s_power(&priv->subdev, 0) < 0)
+			max9286_err("power off failed!");
+	}
+
+	priv->init_ret = (ret < 0) ? ret : 0;
+	max9286_info("ready (%d) %lld ms after probe", priv->init_ret,
+		ktime_us_delta(ktime_get(), priv->probe_start) / 1000);
+	complete_all(&priv->init_done);
+}
+
 static int max9286_probe(struct i2c_client *client,
 			const struct i2c_device_id *did)
 {
 	struct max9286 *priv = NULL;
 	struct soc_camera_subdev_desc *ssdd = soc_camera_i2c_to_desc(client);
-    struct v4l2_subdev *subdev = NULL;
     int ret = 0;
     debug("%s IN--->>> %d\n",__func__,__LINE__);
 	if (client->dev.of_node != NULL) {
@@ -1393,6 +2216,11 @@ static int max9286_probe(struct i2c_client *client,
 	priv = devm_kzalloc(&client->dev, sizeof(struct max9286), GFP_KERNEL);
 	if (priv == NULL)
 		return -ENOMEM;
+	mutex_init(&priv->xfer_lock);
+	mutex_init(&priv->init_lock);
+	priv->probe_start = ktime_get();
+	INIT_WORK(&priv->init_work, max9286_init_work);
+	init_completion(&priv->init_done);
 
     if (max9286_pinctrl_init(&client->dev)<0){
         max9286_err("%s, %d\n", __func__, __LINE__);
@@ -1402,15 +2230,12 @@ static int max9286_probe(struct i2c_client *client,
         max9286_err("%s, %d\n", __func__, __LINE__);
         return -EINVAL;
     }
-    ret = pinctrl_select_state(max9286_pctrl.pinctrl,max9286_pctrl.gpio_state_active);
-    if (ret < 0) {
-        max9286_err("%s, %d\n", __func__, __LINE__);
-        return ret;
-    }
-
-    mdelay(500);
     v4l2_i2c_subdev_init(&priv->subdev, client, &max9286_subdev_ops);
 
+    ret = max9286_regmap_init(client);
+    if (ret < 0)
+        return ret;
+
 	priv->fmt		= &max9286_colour_fmts[0];
 #ifdef sensor_register_debug
     sensor_client = client;
@@ -1427,26 +2252,90 @@ static int max9286_probe(struct i2c_client *client,
     if (ret) {
         debug("luozh: register_addr probe error....\n");
     }
-#endif
-	subdev = i2c_get_clientdata(client);
-
-    ret =  max9286_camera_init(client);
-    if (ret < 0){
-        max9286_err("max9286 camera init failed!\n");
-        if(max9286_s_power(subdev,0)<0){
-            max9286_err("power off failed!\n");
-        }
-        return ret;
+    ret = device_create_file(&client->dev, &dev_attr_i2c_stats);
+    if (ret) {
+        debug("i2c_stats probe error....\n");
+    }
+    ret = device_create_bin_file(&client->dev, &bin_attr_register_dump);
+    if (ret) {
+        debug("register_dump probe error....\n");
     }
+    ret = device_create_file(&client->dev, &dev_attr_reinit);
+    if (ret) {
+        debug("reinit probe error....\n");
+    }
+#endif
 	priv->subdev.dev = &client->dev;
 
-    debug("%s out--->>> %d\n",__func__,__LINE__);
-    return v4l2_async_register_subdev(&priv->subdev);
+	ret = v4l2_async_register_subdev(&priv->subdev);
+	if (ret < 0)
+		return ret;
+
+	priv->regs_dev.minor = MISC_DYNAMIC_MINOR;
+	priv->regs_dev.name = "max9286_regs";
+	priv->regs_dev.fops = &max9286_regs_fops;
+	priv->regs_dev.parent = &client->dev;
+	priv->regs_dev.mode = 0600;
+	ret = misc_register(&priv->regs_dev);
+	if (ret < 0)
+		max9286_err("max9286_regs not registered %d", ret);
+	priv->regs_registered = (ret == 0);
+
+	schedule_work(&priv->init_work);
+
+	return 0;
+}
+
+static int __maybe_unused max9286_suspend(struct device *dev)
+{
+	struct max9286 *priv = to_max9286(to_i2c_client(dev));
+
+	flush_work(&priv->init_work);
+	/* the rail may go down: the whole cache has to be written back */
+	regcache_mark_dirty(priv->rmap[MAX9286_RMAP_DES].map);
+
+	return 0;
+}
+
+/*
+ * The deserializer is restored from its cache. max9286_camera_init()
+ * then finds out which links lost their serializer setup; everything it
+ * writes that the caches already hold is skipped.
+ */
+static int __maybe_unused max9286_resume(struct device *dev)
+{
+	struct i2c_client *client = to_i2c_client(dev);
+	struct max9286 *priv = to_max9286(client);
+	unsigned long xfers = priv->xfer_count;
+	ktime_t start = ktime_get();
+	int ret;
+
+	mutex_lock(&priv->init_lock);
+	ret = max9286_cache_sync(&priv->rmap[MAX9286_RMAP_DES]);
+	if (ret < 0) {
+		max9286_err("deserializer cache sync failed %d", ret);
+		max9286_cache_drop(priv, MAX9286_RMAP_DES, MAX9286_RMAP_SER3);
+	}
+
+	ret = max9286_camera_init(client);
+	mutex_unlock(&priv->init_lock);
+	max9286_info("resume %d: %lu i2c transfers, %lld us", ret,
+		priv->xfer_count - xfers, ktime_us_delta(ktime_get(), start));
+
+	return ret;
 }
 
+static SIMPLE_DEV_PM_OPS(max9286_pm_ops, max9286_suspend, max9286_resume);
+
 static int max9286_remove(struct i2c_client *client)
 {
 	struct soc_camera_subdev_desc *ssdd = soc_camera_i2c_to_desc(client);
+	struct max9286 *priv = to_max9286(client);
+
+	if (priv->regs_registered)
+		misc_deregister(&priv->regs_dev);
+	flush_work(&priv->init_work);
+	v4l2_async_unregister_subdev(&priv->subdev);
 
 	if (ssdd->free_bus != NULL)
 		ssdd->free_bus(ssdd);
@@ -1468,6 +2357,7 @@ static struct i2c_driver max9286_i2c_driver = {
 		.name = "max9286",
 		.of_match_table = max9286_camera_of_match,
 		.probe_type = PROBE_PREFER_ASYNCHRONOUS,
+		.pm = &max9286_pm_ops,
 	},
 	.probe		= max9286_probe,
 	.remove		= max9286_remove,
@@ -1476,6 +2366,10 @@ static struct i2c_driver max9286_i2c_driver = {
 
 module_param(is_testpattern, int, 0644);
 MODULE_PARM_DESC(is_testpattern, "Whether the MAX9286 get test pattern data");
+module_param(cache_writes, int, 0644);
+MODULE_PARM_DESC(cache_writes, "Skip writes the register cache already holds (default 1)");
+module_param(broadcast_init, int, 0644);
+MODULE_PARM_DESC(broadcast_init, "Program shared MAX96705 settings through the broadcast address (default 1)");
 module_i2c_driver(max9286_i2c_driver);
 
 MODULE_DESCRIPTION("MAXIM Camera driver");
@@ -13,11 +13,23 @@
 #include <linux/delay.h>
 #include <linux/i2c.h>
 #include <linux/kernel.h>
+#include <linux/ktime.h>
+#include <linux/mutex.h>
+#include <linux/cache.h>
+#include <linux/math64.h>
+#include <linux/completion.h>
+#include <linux/workqueue.h>
+#include <linux/pm.h>
+#include <linux/regmap.h>
 #include <linux/slab.h>
 #include <linux/videodev2.h>
 #include <linux/module.h>
 #include <linux/v4l2-mediabus.h>
 #include <linux/media-bus-format.h>
+#include <linux/miscdevice.h>
+#include <linux/fs.h>
+#include <linux/uaccess.h>
+#include <linux/firmware.h>
 
 #include <linux/clk.h>
 #include <media/soc_camera.h>
@@ -25,6 +37,9 @@
 #include <media/v4l2-subdev.h>
 #include <linux/regulator/consumer.h>
 
+#include "max_reg_batch.h"
+#include "max_reg_seq.h"
+
 /*
  * About MAX resolution, cropping and binning:
  * This sensor supports it all, at least in the feature description.
@@ -40,6 +55,14 @@
 #define MAX9288_ADDR 0xD0
 #define MAX9288_ID 0x2A
 #define MAX_REG_LEN 2
+/* data bytes in one auto-increment write */
+#define MAX9288_BURST_MAX 32
+/* bursts to one slave sent as a single i2c_transfer() */
+#define MAX9288_BATCH_MSGS 8
+/* one register access: up to 3 address bytes (OV490 entries) plus data */
+#define MAX9288_XFER_LEN 8
+/* register_dump: one auto-increment read covers a whole 8 bit register map */
+#define MAX9288_DUMP_LEN 256
 
 #define MAX9271_INIT_ADDR 0x80
 
@@ -57,15 +80,49 @@
 #define OV490_CH1_MAP_ADDR 0x62
 #define OV490_CH2_MAP_ADDR 0x64
 #define OV490_CH3_MAP_ADDR 0x66
+/* bank select, the upper half of the 32 bit ISP address: 0xFFFD/0xFFFE */
+#define OV490_BANK_REG 0xFFFD
+/* plus 0xFFFF, which {0xFF,0xFE} entries also write: max9288_write_hit() */
+#define OV490_BANK_LEN 3
+/* OV490_INIT_ADDR and the four OV490_CHn_MAP_ADDR */
+#define OV490_BANK_SLOTS 5
+/* power-over-coax switches, see the linux_register_max20088a attribute */
+#define MAX20088A_ADDR 0x52
+#define MAX20086A_ADDR 0x50
 #define MAX9288_1CH_LANE 1
 //#define CAB888_TEST_PATTERN
 
 
 #define OV490_ID 0xB888
 #define MAX9288_LINK_CONFIG_REG 0x00
+/* forward/reverse control channel enable per link */
+#define MAX9288_F_R_CTL_REG 0x0A
 #define MAX9288_ID_REG   0x1E
 #define MAX9288_LOCK_REG 0x04
 #define MAX9288_LINK_REG 0x49
+#define MAX9271_ADDR_REG 0x00
+#define MAX9271_DES_ADDR_REG 0x01
+/* I2C address translation: source/destination A and B */
+#define MAX9271_I2C_XLATE_FIRST 0x09
+#define MAX9271_I2C_XLATE_LAST 0x0C
+/* self-clearing, returns every sensor register to its default */
+#define OV10635_SOFT_RESET_REG 0x0103
+/*
+ * Written over and over by the vendor tables, after the soft reset and
+ * after the MCU firmware load: those runs are settle time, not settings
+ */
+#define OV10635_SETTLE_REG0 0x300C
+#define OV10635_SETTLE_REG1 0x3042
+/* chip id high byte, register 0x300A */
+#define OV10635_PID 0xA6
+/* MAX9288_LOCK_REG: video link locked */
+#define MAX9288_LOCKED 0x80
+/* MAX9288_LINK_REG: config link detected, one bit per link */
+#define MAX9288_CFG_LINK_MASK 0xF0
+/* MAX9288_LINK_REG: video link detected, one bit per link */
+#define MAX9288_VIDEO_LINK_MASK 0x0F
+/* i2c_poll: gap between two reads of the polled register */
+#define MAX9288_POLL_US 200
 
 /* minimum extra blanking */
 #define BLANKING_EXTRA_WIDTH		500
@@ -111,6 +168,9 @@ struct reg_val_ops {
 	unsigned int reg_len;
 	int (*i2c_ops)(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val);
+	/* i2c_poll only: wait for (reg & mask) == val, at most timeout ms */
+	u8 mask;
+	u8 timeout;
 };
 
 static int i2c_write(struct i2c_client *client, u16 slave_addr,
@@ -119,6 +179,8 @@ static int i2c_read(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val);
 static int i2c_delay(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *value);
+static int i2c_poll(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val);
 static int read_max9288_id(struct i2c_client *client, u8 *id_val);
 static int max9288_write_array(struct i2c_client *client,
 		struct reg_val_ops *cmd, unsigned long len);
@@ -149,6 +211,41 @@ static const struct max9288_win_size max9288_supported_win_sizes[] = {
 
 static int is_testpattern;
 
+/*
+ * Table programming: 0 issues one i2c_transfer() per entry, 1 merges runs
+ * of writes to consecutive registers of one slave into auto-increment
+ * bursts, 2 also packs consecutive bursts to the same slave into one
+ * multi-message transfer. Delays and reads always stay barriers.
+ */
+static int coalesce_writes = 1;
+
+/*
+ * Readback of deserializer (0xD0) table writes: 0 off, 1 after every
+ * write, 2 once per table, each register against the last value the
+ * table wrote to it. Mismatches are reported, not treated as failures.
+ */
+static int verify_writes;
+
+/*
+ * Skip writes whose value the register cache already holds. With 0
+ * everything goes to the bus again; the caches are still kept.
+ */
+static int cache_writes = 1;
+
+/*
+ * 1v1: 1 leaves MAX9288_CAB888_1v1_tuning_seq out of camera_init and
+ * writes it from tuning_work after the first s_stream(1), so the link
+ * locks without waiting for the sensor firmware. 0 writes it in place.
+ */
+static int defer_tuning = 1;
+
+/*
+ * Look for the sequences of max9288_seqs in /lib/firmware first; a
+ * missing or malformed blob falls back to the built-in one. 0 always
+ * uses the built-in sequences.
+ */
+static int seq_firmware = 1;
+
 struct sensor_addr {
 	u16 ser_init_addr;
 	u16 ser_last_addr;
@@ -257,7 +354,9 @@ static struct reg_val_ops MAX9288_CAB888_4V4_pre_init_cmd[] = {
 	{MAX9288_ADDR,      {0x3B, 0x00}, 0x1E,               0x01, i2c_write},
 	{MAX9288_ADDR,      {0x00, 0x00}, 0x02,               0x01, i2c_delay},
 	{MAX9271_INIT_ADDR, {0x04, 0x00}, 0x43,               0x01, i2c_write},
-	{MAX9288_ADDR,      {0x00, 0x00}, 0x05,               0x01, i2c_delay},
+	/* config links up; with less than four cameras this takes the full 5 ms */
+	{MAX9288_ADDR,      {MAX9288_LINK_REG, 0x00}, MAX9288_CFG_LINK_MASK, 0x01, i2c_poll,
+		MAX9288_CFG_LINK_MASK, 5},
 	{MAX9288_ADDR,      {0x28, 0x00}, 0x00,               0x01, i2c_read},
 	{MAX9288_ADDR,      {0x28, 0x00}, 0x00,               0x01, i2c_read},
 	{MAX9288_ADDR,      {0x29, 0x00}, 0x00,               0x01, i2c_read},
@@ -347,8 +446,15 @@ static struct reg_val_ops MAX9288_CAB888_4V4_en_cmd[] = {
 	{MAX9288_ADDR,	    {0x0A, 0x00}, 0xFF,               0x01, i2c_write},
 	{MAX9271_ALL_ADDR,  {0x04, 0x00}, 0x83,               0x01, i2c_write},
 	{MAX9288_ADDR,      {0x15, 0x00}, 0x9B,               0x01, i2c_write},
+	/* camera_init checks the lock right after this table */
+	{MAX9288_ADDR,      {MAX9288_LOCK_REG, 0x00}, MAX9288_LOCKED, 0x01, i2c_poll,
+		MAX9288_LOCKED, 5},
 };
 
+/*
+ * 1v1 critical path, together with MAX9288_CAB888_1v1_stream_cmd: link
+ * bring-up and the sensor core setup up to its stream enable.
+ */
 static struct reg_val_ops MAX9288_CAB888_1v1_init_cmd[] = {
         {MAX9288_ADDR,      {0x65, 0x00}, 0x07,             0x01, i2c_write}, // enable CSI 0
         {MAX9288_ADDR,      {0x00, 0x00}, 0x02,             0x01, i2c_delay}, // delay 2ms
@@ -357,7 +463,7 @@ static struct reg_val_ops MAX9288_CAB888_1v1_init_cmd[] = {
         {MAX9288_ADDR,      {0x00, 0x00}, 0x02,             0x01, i2c_delay}, // delay 2ms
 
         {MAX9271_INIT_ADDR, {0x04, 0x00}, 0x43,             0x01, i2c_write}, // off serializer
-        {MAX9288_ADDR,      {0x00, 0x00}, 0x05,             0x01, i2c_delay}, // delay 5ms
+        {MAX9271_INIT_ADDR, {0x04, 0x00}, 0x43,             0x01, i2c_poll, 0xFF, 5}, // config link answers, max 5ms
 
         {MAX9271_INIT_ADDR, {0x01, 0x00}, 0xD0,             0x01, i2c_write}, // modify des addr
         {MAX9288_ADDR,      {0x00, 0x00}, 0x02,             0x01, i2c_delay}, // delay 2ms
@@ -369,7 +475,7 @@ static struct reg_val_ops MAX9288_CAB888_1v1_init_cmd[] = {
 
         /* Sensor Setting */
         {SENSOR_INIT_ADDR,  {0x01, 0x03}, 0x61,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x00, 0x00}, 0x05,             0x01, i2c_delay}, // delay 5ms
+        {SENSOR_INIT_ADDR,  {0x30, 0x0A}, OV10635_PID,      0x02, i2c_poll, 0xFF, 5}, // out of reset, max 5ms
 
         {SENSOR_INIT_ADDR,  {0x30, 0x0c}, 0x61,             0x02, i2c_write},
         {SENSOR_INIT_ADDR,  {0x30, 0x0c}, 0x61,             0x02, i2c_write},
@@ -664,1630 +770,306 @@ static struct reg_val_ops MAX9288_CAB888_1v1_init_cmd[] = {
         {SENSOR_INIT_ADDR,  {0x30, 0x23}, 0x10,             0x02, i2c_write},
         {SENSOR_INIT_ADDR,  {0x01, 0x00}, 0x01,             0x02, i2c_write},
         {SENSOR_INIT_ADDR,  {0x01, 0x00}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x10}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x11}, 0x82,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x12}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x13}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x14}, 0x1f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x15}, 0xdd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x16}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x17}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x18}, 0x36,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x19}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1a}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1b}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1c}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1d}, 0xe7,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1e}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x1f}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x00}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x01}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x02}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x03}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x04}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x05}, 0xad,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x06}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x07}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x08}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x09}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0a}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x0f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x10}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x11}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x12}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x13}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x14}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x15}, 0xad,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x16}, 0x13,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x17}, 0xd0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x18}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x19}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1a}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x1f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x20}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x21}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x22}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x23}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x24}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x25}, 0xad,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x26}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x27}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x28}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x29}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2a}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x2f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x30}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x31}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x32}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x33}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x34}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x35}, 0xad,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x36}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x37}, 0xdc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x38}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x39}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3a}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x3f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x40}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x41}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x42}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x43}, 0xe4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x44}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x45}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x46}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x47}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x48}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x49}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4a}, 0x50,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4b}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4c}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4d}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4e}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x4f}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x50}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x51}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x52}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x53}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x54}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x55}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x56}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x57}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x58}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x59}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5b}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5c}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5d}, 0xce,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5e}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x5f}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x60}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x61}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x62}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x63}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x64}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x65}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x66}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x67}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x68}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x69}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6a}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6b}, 0x76,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6c}, 0x1a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x6f}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x70}, 0xaa,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x71}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x72}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x73}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x74}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x75}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x76}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x77}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x78}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x79}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7a}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7b}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7d}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x7f}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x80}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x81}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x82}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x83}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x84}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x85}, 0xc6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x86}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x87}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x88}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x89}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8c}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8d}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8e}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x8f}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x90}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x91}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x92}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x93}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x94}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x95}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x96}, 0xf8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x97}, 0xfd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x98}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x99}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9b}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9c}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9d}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0x9f}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa0}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa1}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa3}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa4}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa5}, 0xc6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa6}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa7}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa8}, 0xe1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xa9}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xaa}, 0x58,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xab}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xac}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xad}, 0x8e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xae}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xaf}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb0}, 0xe1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb1}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb2}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb4}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb5}, 0xb0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb8}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xb9}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xba}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xbb}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xbc}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xbd}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xbe}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xbf}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc0}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc3}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc4}, 0x95,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc5}, 0x8b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc8}, 0x94,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xc9}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xca}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xcb}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xcc}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xcd}, 0x65,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xce}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xcf}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd0}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd3}, 0x62,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd4}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd8}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xd9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xda}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xdb}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xdc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xdd}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xde}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xdf}, 0x29,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe1}, 0xe3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe2}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe3}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe4}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe5}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe8}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xe9}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xea}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xeb}, 0x09,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xec}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xed}, 0xc3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xee}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xef}, 0x2a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf0}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf1}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf2}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf4}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf5}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf8}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xf9}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xfa}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xfb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xfc}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xfd}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xfe}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd0, 0xff}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x00}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x01}, 0x90,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x02}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x03}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x04}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x05}, 0xae,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x06}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x07}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x08}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x09}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0a}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0b}, 0x4c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0c}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0d}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x0f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x10}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x11}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x12}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x13}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x14}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x15}, 0x65,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x16}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x17}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x18}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x19}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1a}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1c}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x1f}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x20}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x21}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x22}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x23}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x24}, 0x94,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x25}, 0x65,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x26}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x27}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x28}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x29}, 0x43,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2a}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2c}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x2f}, 0x3e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x30}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x31}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x32}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x33}, 0x24,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x34}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x35}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x36}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x37}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x38}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x39}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3a}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3b}, 0x24,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3c}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3d}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x3f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x40}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x41}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x42}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x43}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x44}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x45}, 0x23,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x46}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x47}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x48}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x49}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4b}, 0x2a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4c}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4d}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4e}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x4f}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x50}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x51}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x52}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x53}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x54}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x55}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x56}, 0x3d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x57}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x58}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x59}, 0x67,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5c}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5d}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x5f}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x60}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x61}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x62}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x63}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x64}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x65}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x66}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x67}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x68}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x69}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6b}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6c}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6d}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6e}, 0x67,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x6f}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x70}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x71}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x72}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x73}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x74}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x75}, 0x8a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x76}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x77}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x78}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x79}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7a}, 0x67,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7b}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7c}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7d}, 0xc4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x7f}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x80}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x81}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x82}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x83}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x84}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x85}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x86}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x87}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x88}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x89}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8a}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8b}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8d}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8e}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x8f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x90}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x91}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x92}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x93}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x94}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x95}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x96}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x97}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x98}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x99}, 0x0a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9a}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9c}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9d}, 0x0b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9e}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0x9f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa0}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa1}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa4}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa5}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa6}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa8}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xa9}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xaa}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xab}, 0x22,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xac}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xad}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xae}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xaf}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb1}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb2}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb3}, 0x43,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb4}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb5}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb6}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb8}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xb9}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xba}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xbb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xbc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xbd}, 0xc8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xbe}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xbf}, 0x42,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc0}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc1}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc4}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc5}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc7}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc8}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xc9}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xca}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xcb}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xcc}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xcd}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xce}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xcf}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd0}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd1}, 0x67,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd4}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd5}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd6}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd8}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xd9}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xda}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xdb}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xdc}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xdd}, 0x43,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xde}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xdf}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe0}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe3}, 0x5b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe4}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe5}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe7}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe8}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xe9}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xea}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xeb}, 0xf6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xec}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xed}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xee}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xef}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf1}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf2}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf3}, 0x86,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf4}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf5}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf8}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xf9}, 0xc4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xfa}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xfb}, 0x45,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xfc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xfd}, 0xe4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xfe}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd1, 0xff}, 0x87,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x00}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x01}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x02}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x03}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x04}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x05}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x06}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x07}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x08}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x09}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0a}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0b}, 0x46,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0c}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0d}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0e}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x0f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x10}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x11}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x12}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x13}, 0x88,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x14}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x15}, 0x65,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x16}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x17}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x18}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x19}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1a}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1c}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1d}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1e}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x1f}, 0xce,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x20}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x21}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x22}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x23}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x24}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x25}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x26}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x27}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x28}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x29}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2b}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2c}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2d}, 0x23,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x2f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x30}, 0x13,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x31}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x32}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x33}, 0xc8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x34}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x35}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x36}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x37}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x38}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x39}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3a}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3b}, 0x86,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3c}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3d}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3e}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x3f}, 0x87,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x40}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x41}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x42}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x43}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x44}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x45}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x46}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x47}, 0x88,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x48}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x49}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4a}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4c}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4d}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4e}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x4f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x50}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x51}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x52}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x53}, 0xc1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x54}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x55}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x56}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x57}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x58}, 0x94,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x59}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5b}, 0x72,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5c}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5d}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5e}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x5f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x60}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x61}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x62}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x63}, 0x3f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x64}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x65}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x66}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x67}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x68}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x69}, 0x4e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6c}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6d}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x6f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x70}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x71}, 0x8a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x72}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x73}, 0x6f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x74}, 0xe5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x75}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x76}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x77}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x78}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x79}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7b}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x7f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x80}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x81}, 0xaa,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x82}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x83}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x84}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x85}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x86}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x87}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x88}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x89}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8a}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8b}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8c}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8d}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8e}, 0xf8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x8f}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x90}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x91}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x92}, 0x5b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x93}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x94}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x95}, 0x6a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x96}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x97}, 0x77,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x98}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x99}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9a}, 0x5b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9b}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9c}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9d}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0x9f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa0}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa3}, 0x3c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa4}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa8}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xa9}, 0x8a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xaa}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xab}, 0x78,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xac}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xad}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xae}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xaf}, 0x88,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb0}, 0xe1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb1}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb2}, 0x5b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb3}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb4}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb5}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb8}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xb9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xba}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xbb}, 0x34,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xbc}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xbd}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xbe}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xbf}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc0}, 0xb9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc1}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc3}, 0x88,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc4}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc5}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc7}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc8}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xc9}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xca}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xcb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xcc}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xcd}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xce}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xcf}, 0x2c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd0}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd1}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd2}, 0x58,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd3}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd4}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd5}, 0x81,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd7}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd8}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xd9}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xda}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xdb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xdc}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xdd}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xde}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xdf}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe0}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe1}, 0xc1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe3}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe4}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe5}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe6}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe8}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xe9}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xea}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xeb}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xec}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xed}, 0xc1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xee}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xef}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf0}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf1}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf4}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf7}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf8}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xf9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xfa}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xfb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xfc}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xfd}, 0x61,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xfe}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd2, 0xff}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x00}, 0xbd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x01}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x02}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x03}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x04}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x05}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x06}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x07}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x08}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x09}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0a}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0c}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0d}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0e}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x0f}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x10}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x11}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x12}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x13}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x14}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x15}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x16}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x17}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x18}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x19}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1a}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1b}, 0x29,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1c}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1d}, 0xc3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1e}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x1f}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x20}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x21}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x22}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x23}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x24}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x25}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x26}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x27}, 0x2a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x28}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x29}, 0xe3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2a}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2b}, 0x09,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2d}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2e}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x2f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x30}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x31}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x32}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x33}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x34}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x35}, 0x65,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x36}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x37}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x38}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x39}, 0x81,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3b}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3c}, 0xe3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3d}, 0xe3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3e}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x3f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x40}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x41}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x42}, 0xf8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x43}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x44}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x45}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x46}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x47}, 0x6f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x48}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x49}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4b}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4c}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4d}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4e}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x4f}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x50}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x51}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x52}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x53}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x54}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x55}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x56}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x57}, 0x11,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x58}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x59}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5a}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5b}, 0x43,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5d}, 0x6c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5e}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x5f}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x60}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x61}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x62}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x63}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x64}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x65}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x66}, 0xf8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x67}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x68}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x69}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6b}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6c}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6d}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6e}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x6f}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x70}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x71}, 0x4e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x72}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x73}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x74}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x75}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x76}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x77}, 0xe7,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x78}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x79}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7a}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7b}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7c}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7d}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x7f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x80}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x81}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x82}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x83}, 0xdb,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x84}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x85}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x86}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x87}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x88}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x89}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8a}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8b}, 0xce,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8c}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8d}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x8f}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x90}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x91}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x92}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x93}, 0xc6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x94}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x95}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x96}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x97}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x98}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x99}, 0xe3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9a}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9b}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9c}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9d}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0x9f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa1}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa2}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa3}, 0x0e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa4}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa5}, 0xc3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa6}, 0x6e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa7}, 0x42,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa8}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xa9}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xaa}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xab}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xac}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xad}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xae}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xaf}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb0}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb1}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb2}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb4}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb5}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb8}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xb9}, 0x41,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xba}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xbb}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xbc}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xbd}, 0x81,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xbe}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xbf}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc0}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc1}, 0xc1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc3}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc4}, 0x86,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc5}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc7}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc8}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xc9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xca}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xcb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xcc}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xcd}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xce}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xcf}, 0x1c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd0}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd1}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd2}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd3}, 0xfc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd4}, 0xd4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd5}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd6}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd8}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xd9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xda}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xdb}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xdc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xdd}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xde}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xdf}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe0}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe1}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe3}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe4}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe5}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe8}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xe9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xea}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xeb}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xec}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xed}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xee}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xef}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf0}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf1}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf2}, 0xd9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf3}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf4}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf8}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xf9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xfa}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xfb}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xfc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xfd}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xfe}, 0xc4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd3, 0xff}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x00}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x01}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x02}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x03}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x04}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x05}, 0x23,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x06}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x07}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x08}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x09}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0b}, 0x25,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0c}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x0f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x10}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x11}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x12}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x13}, 0x0b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x14}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x15}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x16}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x17}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x18}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x19}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1a}, 0xd6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1b}, 0x24,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1c}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x1f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x20}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x21}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x22}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x23}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x24}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x25}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x26}, 0xc4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x27}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x28}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x29}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2c}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2d}, 0x23,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x2f}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x30}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x31}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x32}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x33}, 0x1b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x34}, 0x9d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x35}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x36}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x37}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x38}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x39}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3b}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3c}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3d}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x3f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x40}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x41}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x42}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x43}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x44}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x45}, 0x67,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x46}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x47}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x48}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x49}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4a}, 0xce,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4b}, 0xb0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4c}, 0x19,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4d}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x4f}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x50}, 0xa9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x51}, 0x6b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x52}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x53}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x54}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x55}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x56}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x57}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x58}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x59}, 0xc6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5b}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5d}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5e}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x5f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x60}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x61}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x62}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x63}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x64}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x65}, 0xa3,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x66}, 0x58,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x67}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x68}, 0xa4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x69}, 0xc6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6b}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6c}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6d}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x6f}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x70}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x71}, 0x46,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x72}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x73}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x74}, 0x94,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x75}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x76}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x77}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x78}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x79}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7b}, 0x98,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7c}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7d}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7e}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x7f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x80}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x81}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x82}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x83}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x84}, 0xdc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x85}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x86}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x87}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x88}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x89}, 0x68,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8b}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8c}, 0xa5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8d}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x8f}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x90}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x91}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x92}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x93}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x94}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x95}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x96}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x97}, 0xea,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x98}, 0xb8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x99}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9b}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9c}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9d}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0x9f}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa1}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa2}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa3}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa4}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa5}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa6}, 0xe4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa7}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa8}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xa9}, 0x83,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xaa}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xab}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xac}, 0x85,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xad}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xae}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xaf}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb0}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb2}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb4}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb5}, 0x21,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb7}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb8}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xb9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xba}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xbb}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xbc}, 0x9c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xbd}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xbe}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xbf}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc1}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc2}, 0x09,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc3}, 0xef,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc4}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc5}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc6}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc8}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xc9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xca}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xcb}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xcc}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xcd}, 0x63,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xce}, 0xc9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xcf}, 0xef,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd0}, 0xd8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd1}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd2}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd4}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd6}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd8}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xd9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xda}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xdb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xdc}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xdd}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xde}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xdf}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe0}, 0xa8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe1}, 0x84,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe2}, 0x0a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe3}, 0x12,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe4}, 0x8c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe5}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe8}, 0xbc,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xe9}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xea}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xeb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xec}, 0x13,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xed}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xee}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xef}, 0xfe,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf0}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf4}, 0x44,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf6}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf8}, 0x15,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xf9}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xfa}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xfb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xfc}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xfd}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xfe}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd4, 0xff}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd5, 0x00}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd5, 0x01}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd5, 0x02}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xd5, 0x03}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x0e}, 0x33,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x0f}, 0x33,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x0e}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x0f}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x10}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x11}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x12}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x13}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x05}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x08}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x46, 0x09}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x68, 0x04}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x68, 0x05}, 0x06,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x68, 0x06}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x51, 0x20}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x35, 0x10}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x35, 0x04}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x68, 0x00}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x0d}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x50, 0x00}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x50, 0x01}, 0xbf,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x50, 0x02}, 0x7e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x50, 0x03}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x50, 0x3d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x50}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x52}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x53}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x54}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x55}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x56}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x57}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x58}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x59}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x5b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x5c}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x5d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x5e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x5f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x60}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x61}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x62}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x64}, 0x88,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x65}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x66}, 0x8a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x67}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x68}, 0x86,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x69}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6a}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6b}, 0x50,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6c}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6d}, 0x28,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6e}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x6f}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x7c}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x7d}, 0x38,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x7e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x7f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x80}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x81}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x82}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x83}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x84}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x85}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x86}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x87}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x88}, 0x34,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x89}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8a}, 0x34,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8c}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8d}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x8f}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x90}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x92}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x93}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x98}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x99}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9a}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9c}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9e}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0x9f}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa0}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa2}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa4}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa5}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa7}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa8}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xa9}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xaa}, 0x0d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xab}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xac}, 0x0f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xad}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb4}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb5}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb7}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb8}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xb9}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xba}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbc}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbd}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbe}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbf}, 0x33,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xc8}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xc9}, 0xd0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xca}, 0x0e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xcb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xcc}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xcd}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xce}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xcf}, 0x18,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xd0}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xd1}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe0}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe1}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe2}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe4}, 0x10,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe5}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe6}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe7}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe8}, 0x50,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xe9}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xea}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xeb}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xec}, 0x90,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xed}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xee}, 0xb0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xef}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf0}, 0xd0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf1}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf2}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf3}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf4}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf5}, 0x20,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf6}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf8}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xf9}, 0x0b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xfa}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xfb}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xfc}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xfd}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xfe}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xff}, 0x02,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x00}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x01}, 0x74,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x02}, 0x58,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x03}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x04}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x05}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x06}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x07}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x08}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x09}, 0xc0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0a}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0b}, 0xa0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0c}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0d}, 0x2c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0e}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x0f}, 0x0a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x10}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x11}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x12}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x13}, 0x80,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x14}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x15}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x18}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x19}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x1a}, 0x07,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc5, 0x1b}, 0x70,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe0}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe1}, 0x51,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe3}, 0xd6,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe4}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe5}, 0x5e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xe9}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xea}, 0x7a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xeb}, 0x90,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xed}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xee}, 0x7a,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc2, 0xef}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x08}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x09}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x0a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x0c}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x0d}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x0e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x0f}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x10}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x11}, 0x60,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x12}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x13}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x14}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x15}, 0x7f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x16}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x17}, 0x0b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x18}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x19}, 0x0c,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1a}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1b}, 0xe0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1c}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1d}, 0x14,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x1f}, 0xc5,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x20}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x21}, 0x4b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x22}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x23}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x24}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x25}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x26}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x27}, 0x46,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x28}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x29}, 0xd2,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2a}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2b}, 0xe4,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2c}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2d}, 0xbb,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x2f}, 0x61,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x30}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x31}, 0xf9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x32}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x33}, 0xd9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x34}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x35}, 0x2e,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x36}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x37}, 0xb1,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x38}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x39}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3a}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3b}, 0xeb,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3c}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3d}, 0xe8,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3e}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x3f}, 0x48,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x40}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x41}, 0xd0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x42}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x43}, 0xed,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x44}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x45}, 0xad,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x46}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x47}, 0x66,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x48}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x49}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x00}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x01}, 0x7b,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x02}, 0xfd,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x03}, 0xf9,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x04}, 0x3d,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x05}, 0x71,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x06}, 0x78,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x67, 0x08}, 0x05,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x06}, 0x6f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x07}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x0a}, 0x6f,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x0b}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x6f, 0x00}, 0x03,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x4c}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x4d}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x4e}, 0x46,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x4f}, 0x55,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x50}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x51}, 0x40,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x52}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x53}, 0xff,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x54}, 0x04,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x55}, 0x08,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x56}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x57}, 0xef,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x58}, 0x30,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x59}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x5a}, 0x64,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x5b}, 0x46,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc3, 0x5c}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x42}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x1b}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x1c}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0x30, 0x1a}, 0xf0,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb0}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb1}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb2}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb3}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb4}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb5}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb6}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xce, 0xb7}, 0x00,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbc}, 0x01,             0x02, i2c_write},
-        {SENSOR_INIT_ADDR,  {0xc4, 0xbd}, 0x60,             0x02, i2c_write},
-        // end Sensor setting.
+};
+
+/*
+ * OV10635 firmware download and its AEC/AWB settings. The sensor already
+ * streams with the registers above, so with defer_tuning these go out
+ * from tuning_work once streaming has started, see max9288_s_stream().
+ * Kept as a compact sequence: as a table it took 39 KB.
+ */
+static const u8 MAX9288_CAB888_1v1_tuning_seq[] = {
+	MRSEQ_SLAVE_OP(SENSOR_INIT_ADDR, 2),
+	MRSEQ_BURST16(0x6f10, 16),
+		0x07, 0x82, 0x04, 0x00, 0x1f, 0xdd, 0x04, 0x04,
+		0x36, 0x66, 0x04, 0x08, 0x0c, 0xe7, 0x04, 0x0c,
+	MRSEQ_BURST16(0xd000, 255),
+		0x19, 0xa0, 0x00, 0x01, 0xa9, 0xad, 0x10, 0x40,
+		0x44, 0x00, 0x68, 0x00, 0x15, 0x00, 0x00, 0x00,
+		0x19, 0xa0, 0x00, 0x01, 0xa9, 0xad, 0x13, 0xd0,
+		0x44, 0x00, 0x68, 0x00, 0x15, 0x00, 0x00, 0x00,
+		0x19, 0xa0, 0x00, 0x01, 0xa9, 0xad, 0x14, 0xb8,
+		0x44, 0x00, 0x68, 0x00, 0x15, 0x00, 0x00, 0x00,
+		0x19, 0xa0, 0x00, 0x01, 0xa9, 0xad, 0x14, 0xdc,
+		0x44, 0x00, 0x68, 0x00, 0x15, 0x00, 0x00, 0x00,
+		0x9c, 0x21, 0xff, 0xe4, 0xd4, 0x01, 0x48, 0x00,
+		0xd4, 0x01, 0x50, 0x04, 0xd4, 0x01, 0x60, 0x08,
+		0xd4, 0x01, 0x70, 0x0c, 0xd4, 0x01, 0x80, 0x10,
+		0x19, 0xc0, 0x00, 0x01, 0xa9, 0xce, 0x02, 0xa4,
+		0x9c, 0xa0, 0x00, 0x00, 0x84, 0x6e, 0x00, 0x00,
+		0xd8, 0x03, 0x28, 0x76, 0x1a, 0x00, 0x00, 0x01,
+		0xaa, 0x10, 0x03, 0xf0, 0x18, 0x60, 0x00, 0x01,
+		0xa8, 0x63, 0x07, 0x80, 0xe0, 0xa0, 0x00, 0x04,
+		0x18, 0xc0, 0x00, 0x00, 0xa8, 0xc6, 0x00, 0x00,
+		0x8c, 0x63, 0x00, 0x00, 0xd4, 0x01, 0x28, 0x14,
+		0xd4, 0x01, 0x30, 0x18, 0x07, 0xff, 0xf8, 0xfd,
+		0x9c, 0x80, 0x00, 0x03, 0xa5, 0x6b, 0x00, 0xff,
+		0x18, 0xc0, 0x00, 0x01, 0xa8, 0xc6, 0x01, 0x02,
+		0xe1, 0x6b, 0x58, 0x00, 0x84, 0x8e, 0x00, 0x00,
+		0xe1, 0x6b, 0x30, 0x00, 0x98, 0xb0, 0x00, 0x00,
+		0x8c, 0x64, 0x00, 0x6e, 0xe5, 0xa5, 0x18, 0x00,
+		0x10, 0x00, 0x00, 0x06, 0x95, 0x8b, 0x00, 0x00,
+		0x94, 0xa4, 0x00, 0x70, 0xe5, 0x65, 0x60, 0x00,
+		0x0c, 0x00, 0x00, 0x62, 0x15, 0x00, 0x00, 0x00,
+		0x18, 0x60, 0x80, 0x06, 0xa8, 0x83, 0x38, 0x29,
+		0xa8, 0xe3, 0x40, 0x08, 0x8c, 0x84, 0x00, 0x00,
+		0xa8, 0xa3, 0x40, 0x09, 0xa8, 0xc3, 0x38, 0x2a,
+		0xd8, 0x07, 0x20, 0x00, 0x8c, 0x66, 0x00, 0x00,
+		0xd8, 0x05, 0x18, 0x00, 0x18, 0x60, 0x00,
+	MRSEQ_BURST16(0xd0ff, 255),
+		0x01, 0x98, 0x90, 0x00, 0x00, 0x84, 0xae, 0x00,
+		0x00, 0xa8, 0x63, 0x06, 0x4c, 0x9c, 0xc0, 0x00,
+		0x00, 0xd8, 0x03, 0x30, 0x00, 0x8c, 0x65, 0x00,
+		0x6e, 0xe5, 0x84, 0x18, 0x00, 0x10, 0x00, 0x00,
+		0x07, 0x18, 0x80, 0x80, 0x06, 0x94, 0x65, 0x00,
+		0x70, 0xe5, 0x43, 0x60, 0x00, 0x0c, 0x00, 0x00,
+		0x3e, 0xa8, 0x64, 0x38, 0x24, 0x18, 0x80, 0x80,
+		0x06, 0xa8, 0x64, 0x38, 0x24, 0x8c, 0x63, 0x00,
+		0x00, 0xa4, 0x63, 0x00, 0x40, 0xbc, 0x23, 0x00,
+		0x00, 0x0c, 0x00, 0x00, 0x2a, 0xa8, 0x64, 0x6e,
+		0x44, 0x19, 0x00, 0x80, 0x06, 0xa8, 0xe8, 0x3d,
+		0x05, 0x8c, 0x67, 0x00, 0x00, 0xb8, 0x63, 0x00,
+		0x18, 0xb8, 0x63, 0x00, 0x98, 0xbc, 0x03, 0x00,
+		0x00, 0x10, 0x00, 0x00, 0x10, 0xa9, 0x48, 0x67,
+		0x02, 0xb8, 0xa3, 0x00, 0x19, 0x8c, 0x8a, 0x00,
+		0x00, 0xa9, 0x68, 0x67, 0x03, 0xb8, 0xc4, 0x00,
+		0x08, 0x8c, 0x6b, 0x00, 0x00, 0xb8, 0x85, 0x00,
+		0x98, 0xe0, 0x63, 0x30, 0x04, 0xe0, 0x64, 0x18,
+		0x00, 0xa4, 0x83, 0xff, 0xff, 0xb8, 0x64, 0x00,
+		0x48, 0xd8, 0x0a, 0x18, 0x00, 0xd8, 0x0b, 0x20,
+		0x00, 0x9c, 0x60, 0x00, 0x00, 0xd8, 0x07, 0x18,
+		0x00, 0xa8, 0x68, 0x38, 0x22, 0x9c, 0x80, 0x00,
+		0x70, 0xa8, 0xe8, 0x38, 0x43, 0xd8, 0x03, 0x20,
+		0x00, 0x9c, 0xa0, 0x00, 0x00, 0xa8, 0xc8, 0x38,
+		0x42, 0x8c, 0x66, 0x00, 0x00, 0x9c, 0xa5, 0x00,
+		0x01, 0xb8, 0x83, 0x00, 0x08, 0xa4, 0xa5, 0x00,
+		0xff, 0x8c, 0x67, 0x00, 0x00, 0xe0, 0x63, 0x20,
+		0x00, 0xa4, 0x63, 0xff, 0xff, 0xbc, 0x43, 0x00,
+		0x07, 0x0c, 0x00, 0x00, 0x5b, 0xbc, 0x05, 0x00,
+		0x02, 0x03, 0xff, 0xff, 0xf6, 0x9c, 0xa0, 0x00,
+		0x00, 0xa8, 0xa4, 0x55, 0x86, 0x8c, 0x63, 0x00,
+		0x00, 0xa8, 0xc4, 0x6e, 0x45, 0xa8, 0xe4,
+	MRSEQ_BURST16(0xd1fe, 255),
+		0x55, 0x87, 0xd8, 0x05, 0x18, 0x00, 0x8c, 0x66,
+		0x00, 0x00, 0xa8, 0xa4, 0x6e, 0x46, 0xd8, 0x07,
+		0x18, 0x00, 0xa8, 0x84, 0x55, 0x88, 0x8c, 0x65,
+		0x00, 0x00, 0xd8, 0x04, 0x18, 0x00, 0x03, 0xff,
+		0xff, 0xce, 0x19, 0x00, 0x80, 0x06, 0x8c, 0x63,
+		0x00, 0x00, 0xa4, 0x63, 0x00, 0x40, 0xbc, 0x23,
+		0x00, 0x00, 0x13, 0xff, 0xff, 0xc8, 0x9d, 0x00,
+		0x00, 0x40, 0xa8, 0x64, 0x55, 0x86, 0xa8, 0xa4,
+		0x55, 0x87, 0xd8, 0x03, 0x40, 0x00, 0xa8, 0x64,
+		0x55, 0x88, 0xd8, 0x05, 0x40, 0x00, 0xd8, 0x03,
+		0x40, 0x00, 0x03, 0xff, 0xff, 0xc1, 0x19, 0x00,
+		0x80, 0x06, 0x94, 0x84, 0x00, 0x72, 0xe5, 0xa4,
+		0x60, 0x00, 0x0c, 0x00, 0x00, 0x3f, 0x9d, 0x60,
+		0x01, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x98, 0x70,
+		0x00, 0x00, 0x8c, 0x8a, 0x00, 0x6f, 0xe5, 0x63,
+		0x20, 0x00, 0x10, 0x00, 0x00, 0x07, 0x15, 0x00,
+		0x00, 0x00, 0x8c, 0xaa, 0x00, 0x6e, 0xe0, 0x63,
+		0x28, 0x02, 0xe0, 0x84, 0x28, 0x02, 0x07, 0xff,
+		0xf8, 0x66, 0xe0, 0x63, 0x5b, 0x06, 0x8c, 0x6a,
+		0x00, 0x77, 0xe0, 0x63, 0x5b, 0x06, 0xbd, 0x63,
+		0x00, 0x00, 0x0c, 0x00, 0x00, 0x3c, 0x15, 0x00,
+		0x00, 0x00, 0x8c, 0x8a, 0x00, 0x78, 0xb8, 0x63,
+		0x00, 0x88, 0xe1, 0x64, 0x5b, 0x06, 0xbd, 0x6b,
+		0x00, 0x00, 0x0c, 0x00, 0x00, 0x34, 0xd4, 0x01,
+		0x18, 0x14, 0xb9, 0x6b, 0x00, 0x88, 0x85, 0x01,
+		0x00, 0x14, 0xbd, 0x68, 0x00, 0x00, 0x0c, 0x00,
+		0x00, 0x2c, 0xd4, 0x01, 0x58, 0x18, 0x84, 0x81,
+		0x00, 0x14, 0xbd, 0xa4, 0x01, 0x00, 0x10, 0x00,
+		0x00, 0x05, 0x84, 0xc1, 0x00, 0x18, 0x9c, 0xa0,
+		0x01, 0x00, 0xd4, 0x01, 0x28, 0x14, 0x84, 0xc1,
+		0x00, 0x18, 0xbd, 0x66, 0x00, 0x00, 0x0c, 0x00,
+		0x00, 0x20, 0x9d, 0x00, 0x00, 0x00, 0x84,
+	MRSEQ_BURST16(0xd2fd, 255),
+		0x61, 0x00, 0x18, 0xbd, 0xa3, 0x01, 0x00, 0x10,
+		0x00, 0x00, 0x03, 0x9c, 0x80, 0x01, 0x00, 0xd4,
+		0x01, 0x20, 0x18, 0x18, 0x60, 0x80, 0x06, 0x85,
+		0x01, 0x00, 0x14, 0xa8, 0x83, 0x38, 0x29, 0xa8,
+		0xc3, 0x40, 0x08, 0x8c, 0x84, 0x00, 0x00, 0xa8,
+		0xa3, 0x38, 0x2a, 0xa8, 0xe3, 0x40, 0x09, 0xe0,
+		0x64, 0x40, 0x00, 0xd8, 0x06, 0x18, 0x00, 0x8c,
+		0x65, 0x00, 0x00, 0x84, 0x81, 0x00, 0x18, 0xe3,
+		0xe3, 0x20, 0x00, 0xd8, 0x07, 0xf8, 0x00, 0x03,
+		0xff, 0xff, 0x6f, 0x18, 0x60, 0x00, 0x01, 0x0f,
+		0xff, 0xff, 0x9d, 0x18, 0x60, 0x80, 0x06, 0x00,
+		0x00, 0x00, 0x11, 0xa8, 0x83, 0x6e, 0x43, 0xe0,
+		0x6c, 0x28, 0x02, 0xe0, 0x84, 0x28, 0x02, 0x07,
+		0xff, 0xf8, 0x30, 0xb8, 0x63, 0x00, 0x08, 0x03,
+		0xff, 0xff, 0xc0, 0x85, 0x4e, 0x00, 0x00, 0x03,
+		0xff, 0xff, 0xe7, 0xd4, 0x01, 0x40, 0x18, 0x9c,
+		0x60, 0x00, 0x00, 0x03, 0xff, 0xff, 0xdb, 0xd4,
+		0x01, 0x18, 0x14, 0x03, 0xff, 0xff, 0xce, 0x9d,
+		0x6b, 0x00, 0xff, 0x03, 0xff, 0xff, 0xc6, 0x9c,
+		0x63, 0x00, 0xff, 0xa8, 0xe3, 0x38, 0x0f, 0x8c,
+		0x84, 0x00, 0x00, 0xa8, 0xa3, 0x38, 0x0e, 0xa8,
+		0xc3, 0x6e, 0x42, 0xd8, 0x07, 0x20, 0x00, 0x8c,
+		0x66, 0x00, 0x00, 0xd8, 0x05, 0x18, 0x00, 0x85,
+		0x21, 0x00, 0x00, 0x85, 0x41, 0x00, 0x04, 0x85,
+		0x81, 0x00, 0x08, 0x85, 0xc1, 0x00, 0x0c, 0x86,
+		0x01, 0x00, 0x10, 0x44, 0x00, 0x48, 0x00, 0x9c,
+		0x21, 0x00, 0x1c, 0x9c, 0x21, 0xff, 0xfc, 0xd4,
+		0x01, 0x48, 0x00, 0x18, 0x60, 0x00, 0x01, 0xa8,
+		0x63, 0x07, 0x80, 0x8c, 0x63, 0x00, 0x68, 0xbc,
+		0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x15,
+		0x00, 0x00, 0x00, 0x07, 0xff, 0xd9, 0x98, 0x15,
+		0x00, 0x00, 0x00, 0x18, 0x60, 0x80, 0x06,
+	MRSEQ_BURST16(0xd3fc, 255),
+		0xa8, 0x63, 0xc4, 0xb8, 0x8c, 0x63, 0x00, 0x00,
+		0xbc, 0x23, 0x00, 0x01, 0x10, 0x00, 0x00, 0x25,
+		0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+		0xb8, 0xe8, 0x00, 0x02, 0x07, 0xff, 0xd6, 0x24,
+		0x15, 0x00, 0x00, 0x00, 0x18, 0x60, 0x80, 0x06,
+		0xa8, 0x63, 0xc4, 0xb8, 0x8c, 0x63, 0x00, 0x00,
+		0xbc, 0x23, 0x00, 0x01, 0x10, 0x00, 0x00, 0x1b,
+		0x9d, 0x00, 0x00, 0x00, 0xb8, 0xe8, 0x00, 0x02,
+		0x9c, 0xc0, 0x00, 0x00, 0x18, 0xa0, 0x80, 0x06,
+		0xe0, 0x67, 0x30, 0x00, 0xa8, 0xa5, 0xce, 0xb0,
+		0x19, 0x60, 0x00, 0x01, 0xa9, 0x6b, 0x06, 0x14,
+		0xe0, 0x83, 0x28, 0x00, 0x9c, 0xc6, 0x00, 0x01,
+		0xe0, 0x63, 0x18, 0x00, 0x8c, 0x84, 0x00, 0x00,
+		0xe0, 0xa3, 0x58, 0x00, 0xa4, 0xc6, 0x00, 0xff,
+		0xb8, 0x64, 0x00, 0x18, 0xbc, 0x46, 0x00, 0x03,
+		0x94, 0x85, 0x00, 0x00, 0xb8, 0x63, 0x00, 0x98,
+		0xe0, 0x64, 0x18, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+		0xdc, 0x05, 0x18, 0x00, 0x9c, 0x68, 0x00, 0x01,
+		0xa5, 0x03, 0x00, 0xff, 0xbc, 0x48, 0x00, 0x01,
+		0x0f, 0xff, 0xff, 0xea, 0xb8, 0xe8, 0x00, 0x02,
+		0x18, 0x60, 0x00, 0x01, 0xa8, 0x63, 0x06, 0x14,
+		0x07, 0xff, 0xe4, 0x05, 0x9c, 0x83, 0x00, 0x10,
+		0x85, 0x21, 0x00, 0x00, 0x44, 0x00, 0x48, 0x00,
+		0x9c, 0x21, 0x00, 0x04, 0x18, 0x60, 0x00, 0x01,
+		0x9c, 0x80, 0xff, 0xff, 0xa8, 0x63, 0x09, 0xef,
+		0xd8, 0x03, 0x20, 0x00, 0x18, 0x60, 0x80, 0x06,
+		0xa8, 0x63, 0xc9, 0xef, 0xd8, 0x03, 0x20, 0x00,
+		0x44, 0x00, 0x48, 0x00, 0x15, 0x00, 0x00, 0x00,
+		0x18, 0x80, 0x00, 0x01, 0xa8, 0x84, 0x0a, 0x12,
+		0x8c, 0x64, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00,
+		0x13, 0xff, 0xff, 0xfe, 0x15, 0x00, 0x00, 0x00,
+		0x44, 0x00, 0x48, 0x00, 0x15, 0x00, 0x00,
+	MRSEQ_BURST16(0xd4fb, 9),
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00,
+	MRSEQ_BURST16(0x6f0e, 2),
+		0x33, 0x33,
+	MRSEQ_BURST16(0x460e, 6),
+		0x08, 0x01, 0x00, 0x01, 0x00, 0x01,
+	MRSEQ_W16(0x4605, 0x08),
+	MRSEQ_BURST16(0x4608, 2),
+		0x00, 0x08,
+	MRSEQ_BURST16(0x6804, 3),
+		0x00, 0x06, 0x00,
+	MRSEQ_W16(0x5120, 0x00),
+	MRSEQ_W16(0x3510, 0x00),
+	MRSEQ_W16(0x3504, 0x00),
+	MRSEQ_W16(0x6800, 0x00),
+	MRSEQ_W16(0x6f0d, 0x0f),
+	MRSEQ_BURST16(0x5000, 4),
+		0xff, 0xbf, 0x7e, 0x0c,
+	MRSEQ_W16(0x503d, 0x00),
+	MRSEQ_W16(0xc450, 0x01),
+	MRSEQ_BURST16(0xc452, 8),
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	MRSEQ_BURST16(0xc45b, 8),
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	MRSEQ_BURST16(0xc464, 12),
+		0x88, 0x00, 0x8a, 0x00, 0x86, 0x00, 0x40, 0x50,
+		0x30, 0x28, 0x60, 0x40,
+	MRSEQ_BURST16(0xc47c, 21),
+		0x01, 0x38, 0x00, 0x00, 0x00, 0xff, 0x00, 0x40,
+		0x00, 0x18, 0x00, 0x18, 0x34, 0x00, 0x34, 0x00,
+		0x00, 0x04, 0x00, 0x04, 0x07,
+	MRSEQ_BURST16(0xc492, 2),
+		0x20, 0x08,
+	MRSEQ_BURST16(0xc498, 22),
+		0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x60,
+		0x03, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x40,
+		0x00, 0x80, 0x0d, 0x00, 0x0f, 0xc0,
+	MRSEQ_BURST16(0xc4b4, 12),
+		0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+		0x01, 0x60, 0x02, 0x33,
+	MRSEQ_BURST16(0xc4c8, 10),
+		0x03, 0xd0, 0x0e, 0x00, 0x10, 0x18, 0x10, 0x18,
+		0x04, 0x80,
+	MRSEQ_BURST16(0xc4e0, 3),
+		0x04, 0x02, 0x01,
+	MRSEQ_BURST16(0xc4e4, 50),
+		0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80,
+		0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0x80,
+		0x00, 0x20, 0x02, 0x00, 0x04, 0x0b, 0x00, 0x00,
+		0x01, 0x00, 0x04, 0x02, 0x48, 0x74, 0x58, 0x80,
+		0x05, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xa0,
+		0x01, 0x2c, 0x01, 0x0a, 0x00, 0x01, 0x01, 0x80,
+		0x04, 0x00,
+	MRSEQ_BURST16(0xc518, 4),
+		0x03, 0x48, 0x07, 0x70,
+	MRSEQ_BURST16(0xc2e0, 6),
+		0x00, 0x51, 0x00, 0xd6, 0x01, 0x5e,
+	MRSEQ_BURST16(0xc2e9, 3),
+		0x01, 0x7a, 0x90,
+	MRSEQ_BURST16(0xc2ed, 3),
+		0x00, 0x7a, 0x64,
+	MRSEQ_BURST16(0xc308, 3),
+		0x00, 0x00, 0x00,
+	MRSEQ_BURST16(0xc30c, 62),
+		0x00, 0x01, 0x00, 0x00, 0x01, 0x60, 0xff, 0x08,
+		0x01, 0x7f, 0xff, 0x0b, 0x00, 0x0c, 0x00, 0xe0,
+		0x00, 0x14, 0x00, 0xc5, 0xff, 0x4b, 0xff, 0xf0,
+		0xff, 0xe8, 0x00, 0x46, 0xff, 0xd2, 0xff, 0xe4,
+		0xff, 0xbb, 0x00, 0x61, 0xff, 0xf9, 0x00, 0xd9,
+		0x00, 0x2e, 0x00, 0xb1, 0xff, 0x64, 0xff, 0xeb,
+		0xff, 0xe8, 0x00, 0x48, 0xff, 0xd0, 0xff, 0xed,
+		0xff, 0xad, 0x00, 0x66, 0x01, 0x00,
+	MRSEQ_BURST16(0x6700, 7),
+		0x04, 0x7b, 0xfd, 0xf9, 0x3d, 0x71, 0x78,
+	MRSEQ_W16(0x6708, 0x05),
+	MRSEQ_BURST16(0x6f06, 2),
+		0x6f, 0x00,
+	MRSEQ_BURST16(0x6f0a, 2),
+		0x6f, 0x00,
+	MRSEQ_W16(0x6f00, 0x03),
+	MRSEQ_BURST16(0xc34c, 17),
+		0x01, 0x00, 0x46, 0x55, 0x00, 0x40, 0x00, 0xff,
+		0x04, 0x08, 0x01, 0xef, 0x30, 0x01, 0x64, 0x46,
+		0x00,
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_W16(0x3042, 0xf0),
+	MRSEQ_BURST16(0x301b, 2),
+		0xf0, 0xf0,
+	MRSEQ_W16(0x301a, 0xf0),
+	MRSEQ_BURST16(0xceb0, 8),
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	MRSEQ_BURST16(0xc4bc, 2),
+		0x01, 0x60,
+};
+
+/* serializer video setup and stream enable, the end of the critical path */
+static struct reg_val_ops MAX9288_CAB888_1v1_stream_cmd[] = {
         {MAX9271_INIT_ADDR,  {0x07, 0x01}, 0x80,            0x01, i2c_write},  // DBL=1, HIBW=0, rising edge
         {MAX9271_INIT_ADDR,  {0x00, 0x00}, 0x05,            0x01, i2c_delay}, // delay 5ms
 
@@ -2349,7 +1131,45 @@ static struct reg_val_ops MAX9288_CAB888_1v1_init_cmd[] = {
 
         {MAX9271_INIT_ADDR,  {0x04, 0x00}, 0x83,            0x01, i2c_write},  // enable Serial Interface
 
-        {MAX9271_INIT_ADDR,  {0x00, 0x00}, 0x05,            0x01, i2c_delay},  // Delay 5ms
+        {MAX9288_ADDR,       {MAX9288_LOCK_REG, 0x00}, MAX9288_LOCKED, 0x01, i2c_poll,
+                MAX9288_LOCKED, 5},  // video link locked, max 5ms
+};
+
+/*
+ * Init sequences a blob in /lib/firmware can replace, see max_reg_seq.h.
+ * Built in is either a table or a compact sequence.
+ */
+enum max9288_seq_id {
+	MAX9288_SEQ_1V1_INIT,
+	MAX9288_SEQ_1V1_TUNING,
+	MAX9288_SEQ_1V1_STREAM,
+	MAX9288_SEQ_COUNT,
+};
+
+struct max9288_seq {
+	const char *fw_name;
+	struct reg_val_ops *cmd;
+	unsigned long len;
+	const u8 *ops;
+	size_t size;
+};
+
+static const struct max9288_seq max9288_seqs[MAX9288_SEQ_COUNT] = {
+	[MAX9288_SEQ_1V1_INIT] = {
+		.fw_name = "max9288_cab888_1v1_init.bin",
+		.cmd = MAX9288_CAB888_1v1_init_cmd,
+		.len = ARRAY_SIZE(MAX9288_CAB888_1v1_init_cmd),
+	},
+	[MAX9288_SEQ_1V1_TUNING] = {
+		.fw_name = "max9288_cab888_1v1_tuning.bin",
+		.ops = MAX9288_CAB888_1v1_tuning_seq,
+		.size = sizeof(MAX9288_CAB888_1v1_tuning_seq),
+	},
+	[MAX9288_SEQ_1V1_STREAM] = {
+		.fw_name = "max9288_cab888_1v1_stream.bin",
+		.cmd = MAX9288_CAB888_1v1_stream_cmd,
+		.len = ARRAY_SIZE(MAX9288_CAB888_1v1_stream_cmd),
+	},
 };
 
 struct max9288_datafmt {
@@ -2357,6 +1177,27 @@ struct max9288_datafmt {
 	enum v4l2_colorspace colorspace;
 };
 
+/* register spaces with a regmap cache, see max9288_rmap_descs */
+enum max9288_rmap_id {
+	MAX9288_RMAP_DES,
+	MAX9288_RMAP_SER0,
+	MAX9288_RMAP_SER3 = MAX9288_RMAP_SER0 + 3,
+	MAX9288_RMAP_SENSOR,
+	MAX9288_RMAP_COUNT,
+};
+
+struct max9288_rmap {
+	struct i2c_client *client;
+	struct regmap *map;
+	u16 slave_addr;
+	unsigned int reg_len;
+	/*
+	 * Normally the regmap only shadows writes the driver already put on
+	 * the bus; its own I/O is enabled just for regcache_sync().
+	 */
+	bool live;
+};
+
 struct max9288 {
 	struct v4l2_subdev		subdev;
 	const struct max9288_datafmt	*fmt;
@@ -2365,6 +1206,59 @@ struct max9288 {
 
 	/* blanking information */
 	u32 link;
+
+	/* table programming: transfers one per entry would take vs issued */
+	unsigned long table_legacy_xfers;
+	unsigned long table_xfers;
+
+	/*
+	 * Every register access goes through these buffers under xfer_lock,
+	 * nothing is allocated per transfer. They sit in the kmalloc'ed
+	 * device struct on their own cache lines, so they are DMA-safe.
+	 */
+	struct mutex xfer_lock;
+	unsigned long xfer_count;
+	u64 xfer_ns;
+	u8 xfer_buf[MAX9288_XFER_LEN] ____cacheline_aligned;
+	u8 burst_buf[MAX9288_BATCH_MSGS * (MAX_REG_LEN + MAX9288_BURST_MAX)]
+		____cacheline_aligned;
+	u8 dump_buf[MAX9288_DUMP_LEN] ____cacheline_aligned;
+	/* /dev/max9288_regs: one message pair per read of a batch */
+	struct i2c_msg batch_msg[2 * MAX_REG_BATCH_MAX];
+	u8 batch_buf[MAX_REG_BATCH_MAX * (MAX_REG_LEN + MAX_REG_VAL_LEN)]
+		____cacheline_aligned;
+	struct miscdevice regs_dev;
+	bool regs_registered;
+
+	struct max9288_rmap rmap[MAX9288_RMAP_COUNT];
+	unsigned long cache_elided;
+	/*
+	 * 4v4: the OV490 bank registers as last written through each of the
+	 * slots of max9288_ov490_slot(), valid where ov490_bank_known has the
+	 * bit of the register set
+	 */
+	u8 ov490_bank[OV490_BANK_SLOTS][OV490_BANK_LEN];
+	u8 ov490_bank_known[OV490_BANK_SLOTS];
+	/* i2c_poll: how long the polls waited against their timeouts */
+	unsigned long poll_count;
+	unsigned long poll_timeouts;
+	u64 poll_wait_us;
+	u64 poll_budget_us;
+	/* power-up and programming run in init_work, off the probe path */
+	struct work_struct init_work;
+	struct completion init_done;
+	int init_ret;
+	ktime_t probe_start;
+	/* probe to the end of the critical path, i.e. to the first frame */
+	s64 first_frame_us;
+	/* deferred sensor tuning, see defer_tuning */
+	struct work_struct tuning_work;
+	bool tuning_pending;
+	bool streaming;
+	s64 tuning_us;
+	/* blobs from /lib/firmware, NULL: built-in, see max9288_seq_run() */
+	const struct firmware *seq_fw[MAX9288_SEQ_COUNT];
+	bool seq_fw_tried[MAX9288_SEQ_COUNT];
 };
 
 static const struct max9288_datafmt max9288_colour_fmts[] = {
@@ -2380,29 +1274,42 @@ static int i2c_delay(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *value)
 {
 	max9288_info("delay %d ms", *value);
-	mdelay(*value);
+	usleep_range(*value * 1000, *value * 1000 + 500);
 
 	return 0;
 }
 
+/* called with xfer_lock held */
+static int max9288_transfer(struct i2c_client *client, struct i2c_msg *msg,
+		int num)
+{
+	struct max9288 *priv = to_max9288(client);
+	u64 start = ktime_get_ns();
+	int ret;
+
+	ret = i2c_transfer(client->adapter, msg, num);
+	priv->xfer_count++;
+	priv->xfer_ns += ktime_get_ns() - start;
+
+	return ret;
+}
+
 static int i2c_read(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val)
 {
-	int ret = 0;
-	u8 *data = NULL;
+	struct max9288 *priv = to_max9288(client);
+	u8 *data = priv->xfer_buf;
 	struct i2c_msg msg[2];
-	unsigned int size = reg_len + 1u;
+	int ret = 0;
 
-	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u)) {
+	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u) ||
+	    (reg_len >= MAX9288_XFER_LEN)) {
 		max9288_err("reg/val/reg_len is %02x/%02x/%d",
 			*reg, *val, reg_len);
 		return -EINVAL;
 	}
 
-	data = kzalloc(size, GFP_KERNEL);
-	if (data == NULL)
-		return -ENOSPC;
-
+	mutex_lock(&priv->xfer_lock);
 	(void)memcpy(data, reg, reg_len);
 	(void)memset(msg, 0, sizeof(msg));
 
@@ -2418,11 +1325,10 @@ static int i2c_read(struct i2c_client *client, u16 slave_addr,
 
 	client->addr = (slave_addr >> 1);
 
-	ret = i2c_transfer(client->adapter, msg, 2);
+	ret = max9288_transfer(client, msg, 2);
 
 	*val = *(data + reg_len);
-	kfree(data);
-	data = NULL;
+	mutex_unlock(&priv->xfer_lock);
 #if 1
     if(slave_addr == 0xD0){
         max9288_info(" luozh read dev/reg/val/ret is 0x%02x/0x%02x%02x/0x%x/%d\n",
@@ -2432,30 +1338,122 @@ static int i2c_read(struct i2c_client *client, u16 slave_addr,
 	return ret;
 }
 
-static int i2c_write(struct i2c_client *client, u16 slave_addr,
+/* count registers from reg on in one auto-increment read */
+static int max9288_read_burst(struct i2c_client *client, u16 slave_addr,
+		u8 reg, u8 *val, unsigned int count)
+{
+	struct max9288 *priv = to_max9288(client);
+	struct i2c_msg msg[2];
+	int ret = 0;
+
+	if ((val == NULL) || (count == 0u) || (count > MAX9288_DUMP_LEN))
+		return -EINVAL;
+
+	mutex_lock(&priv->xfer_lock);
+	priv->xfer_buf[0] = reg;
+	(void)memset(msg, 0, sizeof(msg));
+
+	msg[0].addr = (slave_addr >> 1);
+	msg[0].flags = 0;
+	msg[0].len = 1;
+	msg[0].buf = priv->xfer_buf;
+
+	msg[1].addr = (slave_addr >> 1);
+	msg[1].flags = I2C_M_RD;
+	msg[1].len = (__u16)count;
+	msg[1].buf = priv->dump_buf;
+
+	client->addr = (slave_addr >> 1);
+
+	ret = max9288_transfer(client, msg, 2);
+	if (ret == 2)
+		(void)memcpy(val, priv->dump_buf, count);
+	mutex_unlock(&priv->xfer_lock);
+	max9288_info("read dev/reg/count/ret is %02x/%02x/%u/%d",
+		slave_addr, reg, count, ret);
+
+	return (ret == 2) ? 0 : ((ret < 0) ? ret : -EIO);
+}
+
+/*
+ * Read reg until (value & mask) == (expected & mask), at most timeout_ms.
+ * Read errors count as "not yet": a remote slave does not answer while its
+ * link comes up. Waited time and timeout add up in the i2c_stats node.
+ */
+static int max9288_poll_reg(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 mask, u8 expected,
+		unsigned int timeout_ms)
+{
+	struct max9288 *priv = to_max9288(client);
+	s64 budget_us = (s64)timeout_ms * 1000;
+	ktime_t start = ktime_get();
+	s64 waited_us;
+	u8 val = 0;
+	int ret;
+
+	for (;;) {
+		ret = i2c_read(client, slave_addr, reg, reg_len, &val);
+		waited_us = ktime_us_delta(ktime_get(), start);
+		if ((ret == 2) && ((val & mask) == (expected & mask))) {
+			ret = 0;
+			break;
+		}
+		if (waited_us >= budget_us) {
+			ret = -ETIMEDOUT;
+			break;
+		}
+		usleep_range(MAX9288_POLL_US, MAX9288_POLL_US + 100);
+	}
+
+	priv->poll_count++;
+	priv->poll_wait_us += waited_us;
+	priv->poll_budget_us += budget_us;
+	if (ret < 0)
+		priv->poll_timeouts++;
+	max9288_info("poll dev/reg %02x/%02x: %02x after %lld of %lld us%s",
+		slave_addr, reg[0], val, waited_us, budget_us,
+		(ret < 0) ? ", timed out" : "");
+
+	return ret;
+}
+
+/*
+ * Table op standing in for an i2c_delay of op->timeout ms, so running
+ * into the timeout is not an error. val points into the table entry.
+ */
+static int i2c_poll(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	const struct reg_val_ops *op = container_of(val, struct reg_val_ops, val);
+
+	(void)max9288_poll_reg(client, slave_addr, reg, reg_len, op->mask,
+		*val, op->timeout);
+
+	return 0;
+}
+
+static int max9288_bus_write(struct i2c_client *client, u16 slave_addr,
 		u8 *reg, unsigned int reg_len, u8 *val)
 {
-	u8 *data = NULL;
+	struct max9288 *priv = to_max9288(client);
+	u8 *data = priv->xfer_buf;
 	int ret = 0;
 	struct i2c_msg msg;
 	unsigned int size = reg_len + 1u;
 
-	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u)) {
+	if ((reg == NULL) || (val == NULL) || (reg_len <= 0u) ||
+	    (size > MAX9288_XFER_LEN)) {
 		max9288_err("reg/val/reg_len is %02x/%02x/%d",
 			*reg, *val, reg_len);
 		return -EINVAL;
 	}
 
-	data = kzalloc(size, GFP_KERNEL);
-	if (data == NULL) {
-		max9288_err("kzalloc failed!\n");
-		return -ENOSPC;
-	}
 #if 1
     if(slave_addr == 0xD0){
         max9288_info(" luozhanhong  reg = 0x%x, 0x%02x%02x,val = 0x%x",slave_addr,reg[0],reg[1],val[0]);
     }
 #endif
+	mutex_lock(&priv->xfer_lock);
 	(void)memcpy(data, reg, reg_len);
 	*(data + reg_len) = *val;
 
@@ -2466,139 +1464,1008 @@ static int i2c_write(struct i2c_client *client, u16 slave_addr,
 	msg.buf = data;
 
 	client->addr = (slave_addr >> 1);
-	ret = i2c_transfer(client->adapter, &msg, 1);
+	ret = max9288_transfer(client, &msg, 1);
+	mutex_unlock(&priv->xfer_lock);
 	if (ret != 1) {
 	    max9288_err("write dev/reg/val/ret is %02x/%02x/%02x/%d",
 	        slave_addr, *reg, *val, ret);
     }
 
-	kfree(data);
-	data = NULL;
 	//max9288_info("write dev/reg/val/ret is %02x/%02x/%02x/%d",
 	//          slave_addr, *reg, *val, ret);
 	return ret;
 }
 
-static int read_max9288_id(struct i2c_client *client, u8 *id_val)
+static unsigned int max9288_reg_addr(const u8 *reg, unsigned int reg_len)
 {
-	int ret = 0;
-	u8 max9288_id_reg = MAX9288_ID_REG;
+	return (reg_len == 2u) ? ((reg[0] << 8) | reg[1]) : reg[0];
+}
 
-	ret = i2c_read(client, MAX9288_ADDR, &max9288_id_reg, 1, id_val);
-	if (ret != 2) {
-		max9288_err("ret=%d", ret);
-		return -EIO;
-	}
+static void max9288_reg_bytes(u8 *reg, unsigned int addr, unsigned int reg_len)
+{
+	reg[0] = (reg_len == 2u) ? (u8)(addr >> 8) : (u8)addr;
+	reg[1] = (reg_len == 2u) ? (u8)addr : 0u;
+}
 
-	if (*id_val != (u8)MAX9288_ID) {
-		max9288_err("max9288 ID not match. Default is %x but read from register is %x. ret=%d",
-			MAX9288_ID, *id_val, ret);
-		ret = -ENODEV;
-	} else {
-		max9288_info("max9288 ID match. Default is %x and read from register is %x. ret=%d",
-			MAX9288_ID, *id_val, ret);
+static bool max9288_des_volatile(struct device *dev, unsigned int reg)
+{
+	switch (reg) {
+	case MAX9288_LOCK_REG:
+	case MAX9288_ID_REG:
+	case 0x28 ... 0x2B:	/* link error counters */
+	case 0x34:
+	case MAX9288_LINK_REG:
+		return true;
+	default:
+		return false;
 	}
+}
 
-	return ret;
+static bool max9288_ser_volatile(struct device *dev, unsigned int reg)
+{
+	return (reg == MAX9271_ADDR_REG) || (reg == MAX9288_ID_REG);
 }
 
-static int max9288_write_array(struct i2c_client *client,
-		struct reg_val_ops *cmd, unsigned long len)
+static bool max9288_sensor_volatile(struct device *dev, unsigned int reg)
 {
-	int ret = 0;
-	unsigned long index = 0;
-	u8 val;
+	/* never skipped as cached, so each write of a settle run goes out */
+	return (reg == OV10635_SOFT_RESET_REG) ||
+		(reg == OV10635_SETTLE_REG0) || (reg == OV10635_SETTLE_REG1);
+}
 
-	for (; index < len; ++index) {
-		 //mdelay(5);
-		ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
-			cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
-		if (ret < 0) {
-			max9288_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
-				cmd[index].slave_addr, cmd[index].reg[0],
-				cmd[index].val, ret, index);
-			return ret;
+static int max9288_rmap_read(void *context, unsigned int reg,
+		unsigned int *val)
+{
+	struct max9288_rmap *rm = context;
+	u8 addr[MAX_REG_LEN];
+	u8 data = 0;
+
+	/* a cache lookup that misses must not turn into a bus read */
+	if (!rm->live)
+		return -EBUSY;
+	max9288_reg_bytes(addr, reg, rm->reg_len);
+	if (i2c_read(rm->client, rm->slave_addr, addr, rm->reg_len, &data) != 2)
+		return -EIO;
+	*val = data;
+
+	return 0;
+}
+
+static int max9288_rmap_write(void *context, unsigned int reg,
+		unsigned int val)
+{
+	struct max9288_rmap *rm = context;
+	u8 addr[MAX_REG_LEN];
+	u8 data = (u8)val;
+
+	if (!rm->live)
+		return 0;
+	max9288_reg_bytes(addr, reg, rm->reg_len);
+
+	return (max9288_bus_write(rm->client, rm->slave_addr, addr,
+		rm->reg_len, &data) == 1) ? 0 : -EIO;
+}
+
+#define MAX9288_REGMAP_CONFIG(_name, _reg_bits, _volatile)		\
+	{								\
+		.name		= _name,				\
+		.reg_bits	= _reg_bits,				\
+		.val_bits	= 8,					\
+		.max_register	= (1u << (_reg_bits)) - 1u,		\
+		.volatile_reg	= _volatile,				\
+		.reg_read	= max9288_rmap_read,			\
+		.reg_write	= max9288_rmap_write,			\
+		.cache_type	= REGCACHE_RBTREE,			\
+	}
+
+static const struct max9288_rmap_desc {
+	u16 slave_addr;
+	/* writing this register resets the device or moves it away, or -1 */
+	int drop_reg;
+	struct regmap_config config;
+} max9288_rmap_descs[MAX9288_RMAP_COUNT] = {
+	[MAX9288_RMAP_DES] = { MAX9288_ADDR, -1,
+		MAX9288_REGMAP_CONFIG("max9288", 8, max9288_des_volatile) },
+	[MAX9288_RMAP_SER0] = { MAX9271_CH0_ADDR, MAX9271_ADDR_REG,
+		MAX9288_REGMAP_CONFIG("max9271-0", 8, max9288_ser_volatile) },
+	[MAX9288_RMAP_SER0 + 1] = { MAX9271_CH1_ADDR, MAX9271_ADDR_REG,
+		MAX9288_REGMAP_CONFIG("max9271-1", 8, max9288_ser_volatile) },
+	[MAX9288_RMAP_SER0 + 2] = { MAX9271_CH2_ADDR, MAX9271_ADDR_REG,
+		MAX9288_REGMAP_CONFIG("max9271-2", 8, max9288_ser_volatile) },
+	[MAX9288_RMAP_SER3] = { MAX9271_CH3_ADDR, MAX9271_ADDR_REG,
+		MAX9288_REGMAP_CONFIG("max9271-3", 8, max9288_ser_volatile) },
+	[MAX9288_RMAP_SENSOR] = { SENSOR_INIT_ADDR, OV10635_SOFT_RESET_REG,
+		MAX9288_REGMAP_CONFIG("ov10635", 16, max9288_sensor_volatile) },
+};
+
+static int max9288_regmap_init(struct i2c_client *client)
+{
+	struct max9288 *priv = to_max9288(client);
+	const struct max9288_rmap_desc *desc;
+	struct max9288_rmap *rm;
+	int i;
+
+	for (i = 0; i < MAX9288_RMAP_COUNT; ++i) {
+		desc = &max9288_rmap_descs[i];
+		rm = &priv->rmap[i];
+		rm->client = client;
+		rm->slave_addr = desc->slave_addr;
+		rm->reg_len = desc->config.reg_bits / 8;
+		rm->map = devm_regmap_init(&client->dev, NULL, rm, &desc->config);
+		if (IS_ERR(rm->map)) {
+			max9288_err("regmap %s: %ld", desc->config.name,
+				PTR_ERR(rm->map));
+			return PTR_ERR(rm->map);
 		}
-#if 1
-        if(cmd[index].slave_addr == 0xD0){
-            mdelay(1);
-            ret = i2c_read(client, cmd[index].slave_addr, cmd[index].reg, 1, &val);
-            if (ret < 0) debug("i2c_read error!!!!\n");
-        }
-#endif
 	}
 
 	return 0;
 }
 
-/* static int max9288_set_link_config(struct i2c_client *client, u8 *val) */
-/* { */
-/* 	int ret = 0; */
-/* 	u8 link_config_reg = MAX9288_LINK_CONFIG_REG; */
+static struct max9288_rmap *max9288_rmap_find(struct max9288 *priv,
+		u16 slave_addr, unsigned int reg_len)
+{
+	int i;
 
-/* 	ret = i2c_write(client, MAX9288_ADDR, &link_config_reg, 1, val); */
-/* 	if (ret != 1) { */
-/* 		max9288_info("link config set fail. ret = %d", ret); */
-/* 		return -EIO; */
-/* 	} */
+	for (i = 0; i < MAX9288_RMAP_COUNT; ++i)
+		if ((priv->rmap[i].map != NULL) &&
+		    (priv->rmap[i].slave_addr == slave_addr) &&
+		    (priv->rmap[i].reg_len == reg_len))
+			return &priv->rmap[i];
 
-/* 	return ret; */
-/* } */
+	return NULL;
+}
 
-int max9288_get_lock_status(struct i2c_client *client, u8 *val)
+/* forget what the caches first..last hold, the devices were reset */
+static void max9288_cache_drop(struct max9288 *priv, int first, int last)
 {
-	int ret = 0;
-	u8 lock_reg = MAX9288_LOCK_REG;
+	for (; first <= last; ++first)
+		if (priv->rmap[first].map != NULL)
+			(void)regcache_drop_region(priv->rmap[first].map, 0,
+				max9288_rmap_descs[first].config.max_register);
+}
 
-	ret = i2c_read(client, MAX9288_ADDR, &lock_reg, 1, val);
-	if (ret != 2) {
-		max9288_err("ret=%d", ret);
-		return -EIO;
+/* 4v4 only: in 1v1 SENSOR_INIT_ADDR is the OV10635, not an OV490 */
+static int max9288_ov490_slot(struct max9288 *priv, u16 slave_addr)
+{
+	static const u16 addrs[OV490_BANK_SLOTS] = {
+		OV490_INIT_ADDR, OV490_CH0_MAP_ADDR, OV490_CH1_MAP_ADDR,
+		OV490_CH2_MAP_ADDR, OV490_CH3_MAP_ADDR,
+	};
+	int i;
+
+	if (priv->link != 4U)
+		return -1;
+	for (i = 0; i < OV490_BANK_SLOTS; ++i)
+		if (addrs[i] == slave_addr)
+			return i;
+
+	return -1;
+}
+
+static bool max9288_bank_reg(unsigned int reg, unsigned int reg_len)
+{
+	return (reg_len == 2u) && (reg >= OV490_BANK_REG) &&
+		(reg < OV490_BANK_REG + OV490_BANK_LEN);
+}
+
+/* the OV490s lost power or changed, or what reached them is unknown */
+static void max9288_bank_forget(struct max9288 *priv)
+{
+	(void)memset(priv->ov490_bank_known, 0, sizeof(priv->ov490_bank_known));
+}
+
+/*
+ * OV490_INIT_ADDR reaches the OV490 of every open link, a per-link
+ * address only one: a bank write through either leaves the other kind
+ * of slot unsure of that register.
+ */
+static void max9288_bank_update(struct max9288 *priv, int slot,
+		unsigned int reg, u8 val)
+{
+	unsigned int i = reg - OV490_BANK_REG;
+	int other;
+
+	for (other = 0; other < OV490_BANK_SLOTS; ++other)
+		if ((other == 0) != (slot == 0))
+			priv->ov490_bank_known[other] &= (u8)~BIT(i);
+	priv->ov490_bank[slot][i] = val;
+	priv->ov490_bank_known[slot] |= (u8)BIT(i);
+}
+
+/*
+ * Writes that can change which OV490s a bank slot reaches: link enable
+ * and control channel gating, anything to the serializer broadcast
+ * address, serializer address remaps and I2C translations.
+ */
+static bool max9288_ov490_rerouted(u16 slave_addr, unsigned int reg,
+		unsigned int reg_len)
+{
+	int i;
+
+	if (reg_len != 1u)
+		return false;
+	if (slave_addr == MAX9288_ADDR)
+		return (reg == MAX9288_LINK_CONFIG_REG) ||
+			(reg == MAX9288_F_R_CTL_REG);
+	if (slave_addr == MAX9271_ALL_ADDR)
+		return true;
+	for (i = MAX9288_RMAP_SER0; i <= MAX9288_RMAP_SER3; ++i)
+		if (slave_addr == max9288_rmap_descs[i].slave_addr)
+			return (reg == MAX9271_ADDR_REG) ||
+				((reg >= MAX9271_I2C_XLATE_FIRST) &&
+				 (reg <= MAX9271_I2C_XLATE_LAST));
+
+	return false;
+}
+
+/* true if the cache already holds val, so writing it can be skipped */
+static bool max9288_cache_hit(struct max9288 *priv, u16 slave_addr,
+		unsigned int reg, unsigned int reg_len, u8 val)
+{
+	struct max9288_rmap *rm;
+	unsigned int cur;
+	int slot;
+
+	if (cache_writes == 0)
+		return false;
+	slot = max9288_ov490_slot(priv, slave_addr);
+	if ((slot >= 0) && max9288_bank_reg(reg, reg_len))
+		return ((priv->ov490_bank_known[slot] &
+			 BIT(reg - OV490_BANK_REG)) != 0u) &&
+			(priv->ov490_bank[slot][reg - OV490_BANK_REG] == val);
+	rm = max9288_rmap_find(priv, slave_addr, reg_len);
+
+	/* volatile registers miss: the shadow regmap never reads the bus */
+	return (rm != NULL) && (regmap_read(rm->map, reg, &cur) == 0) &&
+		(cur == val);
+}
+
+/* keeps the caches in step with a write that reached the bus */
+static void max9288_cache_update(struct max9288 *priv, u16 slave_addr,
+		unsigned int reg, unsigned int reg_len, u8 val)
+{
+	struct max9288_rmap *rm = max9288_rmap_find(priv, slave_addr, reg_len);
+	int slot = max9288_ov490_slot(priv, slave_addr);
+	int id;
+
+	if ((slot >= 0) && max9288_bank_reg(reg, reg_len))
+		max9288_bank_update(priv, slot, reg, val);
+	else if (max9288_ov490_rerouted(slave_addr, reg, reg_len))
+		max9288_bank_forget(priv);
+
+	if (rm != NULL) {
+		id = rm - priv->rmap;
+		if ((int)reg == max9288_rmap_descs[id].drop_reg)
+			max9288_cache_drop(priv, id, id);
+		else
+			(void)regmap_write(rm->map, reg, val);
+		return;
 	}
-	max9288_info("camera locke val = 0x%x\n",*val);
-	if ((*val & (u8)0x80) != 0u) {
-		max9288_info("camera links are locked");
-	} else {
-		max9288_err("camera links are not locked");
-		ret =  -ENODEV;
+
+	/* slaves without a cache of their own that reach cached devices */
+	switch (slave_addr) {
+	case MAX9271_ALL_ADDR:
+		/* whichever serializers the deserializer currently forwards to */
+		max9288_cache_drop(priv, MAX9288_RMAP_SER0, MAX9288_RMAP_SER3);
+		break;
+	case OV490_INIT_ADDR:
+		/* translated by the serializers onto the per-link sensor addresses */
+		max9288_cache_drop(priv, MAX9288_RMAP_SENSOR, MAX9288_RMAP_SENSOR);
+		break;
+	case MAX20088A_ADDR:
+	case MAX20086A_ADDR:
+		/* may power cycle the cameras */
+		max9288_cache_drop(priv, MAX9288_RMAP_SER0, MAX9288_RMAP_SENSOR);
+		max9288_bank_forget(priv);
+		break;
+	default:
+		break;
 	}
+}
+
+/* pushes the cache out through the regmap, used after a power loss */
+static int max9288_cache_sync(struct max9288_rmap *rm)
+{
+	int ret;
+
+	rm->live = true;
+	ret = regcache_sync(rm->map);
+	rm->live = false;
 
 	return ret;
 }
 
-/* static int max9288_get_link(struct i2c_client *client, u8 *val) */
-/* { */
-/* 	int ret = 0; */
-/* 	u8 link_reg = MAX9288_LINK_REG; */
+/*
+ * reg_len 3 (OV490) writes go out as reg[0..2] and val, reg[2] being the
+ * table entry's val again, see max9288_bus_write(): to the ISP that is a
+ * 16 bit address and two data bytes, so {0xFF,0xFD}=v sets both bank
+ * registers to v. The caches are kept in those terms.
+ */
+static bool max9288_write_hit(struct max9288 *priv, u16 slave_addr,
+		const u8 *reg, unsigned int reg_len, u8 val)
+{
+	unsigned int addr;
 
-/* 	ret = i2c_read(client, MAX9288_ADDR, &link_reg, 1, val); */
-/* 	if (ret != 2) { */
-/* 		max9288_err("ret=%d", ret); */
-/* 		ret = -EIO; */
-/* 	} */
+	if (reg_len != 3u)
+		return max9288_cache_hit(priv, slave_addr,
+			max9288_reg_addr(reg, reg_len), reg_len, val);
 
-/* 	return ret; */
-/* } */
+	addr = (reg[0] << 8) | reg[1];
+	return max9288_cache_hit(priv, slave_addr, addr, 2u, reg[2]) &&
+		max9288_cache_hit(priv, slave_addr, addr + 1u, 2u, val);
+}
 
-static int max9288_camera_ch_addr_init(struct i2c_client *client,
-	struct reg_val_ops *cmd, unsigned long len, int ch)
+static void max9288_write_update(struct max9288 *priv, u16 slave_addr,
+		const u8 *reg, unsigned int reg_len, u8 val)
 {
-	int ret = 0;
-	unsigned long index = 0;
+	unsigned int addr;
 
-	/*choose channel*/
-	ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
-		cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
-	if (ret < 0) {
-		max9288_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
-			cmd[index].slave_addr, cmd[index].reg[0],
-			cmd[index].val, ret, index);
-		return -1;
+	if (reg_len != 3u) {
+		max9288_cache_update(priv, slave_addr,
+			max9288_reg_addr(reg, reg_len), reg_len, val);
+		return;
 	}
 
-	index = 1;
-	/*read max9271 id use 0x80*/
-	ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
+	addr = (reg[0] << 8) | reg[1];
+	max9288_cache_update(priv, slave_addr, addr, 2u, reg[2]);
+	max9288_cache_update(priv, slave_addr, addr + 1u, 2u, val);
+}
+
+static int i2c_write(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	struct max9288 *priv = to_max9288(client);
+	int ret;
+
+	if (max9288_write_hit(priv, slave_addr, reg, reg_len, *val)) {
+		priv->cache_elided++;
+		return 1;
+	}
+
+	ret = max9288_bus_write(client, slave_addr, reg, reg_len, val);
+	if (ret == 1)
+		max9288_write_update(priv, slave_addr, reg, reg_len, *val);
+
+	return ret;
+}
+
+/*
+ * For writes from user space: always to the bus, the hardware may have
+ * changed behind the cache. The cache still follows.
+ */
+static int max9288_write_through(struct i2c_client *client, u16 slave_addr,
+		u8 *reg, unsigned int reg_len, u8 *val)
+{
+	int ret;
+
+	ret = max9288_bus_write(client, slave_addr, reg, reg_len, val);
+	if (ret == 1)
+		max9288_write_update(to_max9288(client), slave_addr, reg,
+			reg_len, *val);
+
+	return ret;
+}
+
+static int read_max9288_id(struct i2c_client *client, u8 *id_val)
+{
+	int ret = 0;
+	u8 max9288_id_reg = MAX9288_ID_REG;
+
+	ret = i2c_read(client, MAX9288_ADDR, &max9288_id_reg, 1, id_val);
+	if (ret != 2) {
+		max9288_err("ret=%d", ret);
+		return -EIO;
+	}
+
+	if (*id_val != (u8)MAX9288_ID) {
+		max9288_err("max9288 ID not match. Default is %x but read from register is %x. ret=%d",
+			MAX9288_ID, *id_val, ret);
+		ret = -ENODEV;
+	} else {
+		max9288_info("max9288 ID match. Default is %x and read from register is %x. ret=%d",
+			MAX9288_ID, *id_val, ret);
+	}
+
+	return ret;
+}
+
+static bool reg_val_burstable(const struct reg_val_ops *op)
+{
+	return (op->i2c_ops == i2c_write) &&
+		((op->reg_len == 1u) || (op->reg_len == 2u));
+}
+
+/* what max9288_write_bursts() takes: reg_len 3 entries as bursts of one */
+static bool reg_val_batchable(const struct reg_val_ops *op)
+{
+	return reg_val_burstable(op) ||
+		((op->i2c_ops == i2c_write) && (op->reg_len == 3u));
+}
+
+static unsigned int reg_val_addr(const struct reg_val_ops *op)
+{
+	return max9288_reg_addr(op->reg, op->reg_len);
+}
+
+/* entries that wait instead of doing one transfer */
+static bool reg_val_waits(const struct reg_val_ops *op)
+{
+	return (op->i2c_ops == i2c_delay) || (op->i2c_ops == i2c_poll);
+}
+
+static bool reg_val_cached(struct max9288 *priv, const struct reg_val_ops *op)
+{
+	return (op->i2c_ops == i2c_write) && max9288_write_hit(priv,
+		op->slave_addr, op->reg, op->reg_len, op->val);
+}
+
+/* table entries from index on that one auto-increment write can carry */
+static unsigned int max9288_burst_len(struct max9288 *priv,
+		const struct reg_val_ops *cmd, unsigned long index, unsigned long len)
+{
+	unsigned int reg = reg_val_addr(&cmd[index]);
+	unsigned int n = 1;
+
+	while ((index + n < len) && (n < MAX9288_BURST_MAX) &&
+	       reg_val_burstable(&cmd[index + n]) &&
+	       !reg_val_cached(priv, &cmd[index + n]) &&
+	       (cmd[index + n].slave_addr == cmd[index].slave_addr) &&
+	       (cmd[index + n].reg_len == cmd[index].reg_len) &&
+	       (reg_val_addr(&cmd[index + n]) == reg + n))
+		++n;
+
+	return n;
+}
+
+/*
+ * Sends the writes starting at *index as bursts, up to batch of them to
+ * the same slave in one transfer, and advances *index past them. The
+ * caches take each burst as it is queued, so the entries after it are
+ * checked against what the batch leaves behind; a failed transfer drops
+ * them.
+ */
+static int max9288_write_bursts(struct i2c_client *client,
+		struct reg_val_ops *cmd, unsigned long *index, unsigned long len,
+		unsigned int batch)
+{
+	struct max9288 *priv = to_max9288(client);
+	struct i2c_msg msg[MAX9288_BATCH_MSGS];
+	u8 *buf = priv->burst_buf;
+	unsigned long first = *index;
+	unsigned int nmsg = 0;
+	unsigned int n, i;
+	int ret;
+
+	mutex_lock(&priv->xfer_lock);
+	while ((nmsg < batch) && (*index < len) &&
+	       reg_val_batchable(&cmd[*index]) &&
+	       (cmd[*index].slave_addr == cmd[first].slave_addr) &&
+	       ((*index == first) || !reg_val_cached(priv, &cmd[*index]))) {
+		n = reg_val_burstable(&cmd[*index]) ?
+			max9288_burst_len(priv, cmd, *index, len) : 1u;
+		(void)memcpy(buf, cmd[*index].reg, cmd[*index].reg_len);
+		for (i = 0; i < n; ++i)
+			buf[cmd[*index].reg_len + i] = cmd[*index + i].val;
+
+		msg[nmsg].addr = (cmd[first].slave_addr >> 1);
+		msg[nmsg].flags = 0;
+		msg[nmsg].len = (u16)(cmd[*index].reg_len + n);
+		msg[nmsg].buf = buf;
+		buf += MAX_REG_LEN + MAX9288_BURST_MAX;
+		for (i = 0; i < n; ++i)
+			max9288_write_update(priv, cmd[first].slave_addr,
+				cmd[*index + i].reg, cmd[*index + i].reg_len,
+				cmd[*index + i].val);
+		*index += n;
+		++nmsg;
+	}
+
+	client->addr = (cmd[first].slave_addr >> 1);
+	ret = max9288_transfer(client, msg, nmsg);
+	mutex_unlock(&priv->xfer_lock);
+	if (ret != (int)nmsg) {
+		max9288_err("burst dev/reg/msgs/ret/index %x/%x/%u/%d/%lu",
+			cmd[first].slave_addr, cmd[first].reg[0], nmsg, ret, first);
+		max9288_cache_drop(priv, MAX9288_RMAP_DES, MAX9288_RMAP_SENSOR);
+		max9288_bank_forget(priv);
+		return (ret < 0) ? ret : -EIO;
+	}
+
+	return 0;
+}
+
+static bool max9288_verify_reg(struct i2c_client *client,
+		const struct reg_val_ops *op)
+{
+	u8 reg = op->reg[0];
+	u8 val = 0;
+	int ret;
+
+	ret = i2c_read(client, op->slave_addr, &reg, 1, &val);
+	if ((ret != 2) || (val != op->val)) {
+		max9288_err("verify reg %02x: wrote %02x, read %02x (ret %d)",
+			reg, op->val, val, ret);
+		return false;
+	}
+
+	return true;
+}
+
+static bool verify_candidate(const struct reg_val_ops *op)
+{
+	return (op->i2c_ops == i2c_write) && (op->slave_addr == MAX9288_ADDR) &&
+		(op->reg_len == 1u);
+}
+
+/* verify_writes=2: one readback per deserializer register the table set */
+static unsigned long max9288_verify_table(struct i2c_client *client,
+		const struct reg_val_ops *cmd, unsigned long len)
+{
+	unsigned long index, later, checked = 0, bad = 0;
+
+	for (index = 0; index < len; ++index) {
+		if (!verify_candidate(&cmd[index]))
+			continue;
+		/* only the last write to a register is expected to stick */
+		for (later = index + 1; later < len; ++later)
+			if (verify_candidate(&cmd[later]) &&
+			    (cmd[later].reg[0] == cmd[index].reg[0]))
+				break;
+		if (later < len)
+			continue;
+		++checked;
+		if (!max9288_verify_reg(client, &cmd[index]))
+			++bad;
+	}
+	if (checked != 0UL)
+		max9288_info("verified %lu deserializer registers, %lu mismatches",
+			checked, bad);
+
+	return checked;
+}
+
+static int max9288_write_array(struct i2c_client *client,
+		struct reg_val_ops *cmd, unsigned long len)
+{
+	struct max9288 *priv = to_max9288(client);
+	unsigned long legacy = 0, xfers = 0, readbacks = 0, elided = 0;
+	unsigned long index = 0, first;
+	ktime_t start = ktime_get();
+	unsigned int batch;
+	int ret = 0;
+
+	batch = (coalesce_writes >= 2) ? MAX9288_BATCH_MSGS : 1u;
+
+	while (index < len) {
+		first = index;
+		//mdelay(5);
+		if (reg_val_cached(priv, &cmd[index])) {
+			++elided;
+			++legacy;
+			++index;
+			continue;
+		}
+		if ((coalesce_writes > 0) && reg_val_batchable(&cmd[index])) {
+			ret = max9288_write_bursts(client, cmd, &index, len, batch);
+		} else {
+			ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
+				cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
+			if (ret < 0)
+				max9288_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
+					cmd[index].slave_addr, cmd[index].reg[0],
+					cmd[index].val, ret, index);
+			++index;
+		}
+		if (ret < 0)
+			break;
+		if (!reg_val_waits(&cmd[first]))
+			++xfers;
+
+		for (; first < index; ++first) {
+			if (!reg_val_waits(&cmd[first]))
+				++legacy;
+			if ((verify_writes == 1) && verify_candidate(&cmd[first])) {
+				/* give the write time to take effect, without spinning */
+				usleep_range(1000, 1500);
+				(void)max9288_verify_reg(client, &cmd[first]);
+				++readbacks;
+			}
+		}
+		ret = 0;
+	}
+
+	if ((ret == 0) && (verify_writes == 2))
+		readbacks = max9288_verify_table(client, cmd, len);
+
+	priv->table_legacy_xfers += legacy;
+	priv->table_xfers += xfers;
+	priv->cache_elided += elided;
+	max9288_info("%lu entries: %lu i2c transfers (%lu one per entry), %lu cached, %lu readbacks, %lld us",
+		len, xfers, legacy, elided, readbacks,
+		ktime_us_delta(ktime_get(), start));
+
+	return ret;
+}
+
+/* bytes of the op at ops[0], 0 if it runs past the end */
+static size_t mrseq_op_len(const u8 *ops, size_t left, unsigned int reg_len)
+{
+	size_t n;
+
+	switch (ops[0]) {
+	case MRSEQ_END:
+		n = 1;
+		break;
+	case MRSEQ_SLAVE:
+		n = 3;
+		break;
+	case MRSEQ_WRITE:
+		n = 2u + reg_len;
+		break;
+	case MRSEQ_BURST:
+		n = (left >= 2u) ? (2u + reg_len + ops[1]) : 2u;
+		break;
+	case MRSEQ_DELAY:
+		n = 2;
+		break;
+	case MRSEQ_POLL:
+		n = 4u + reg_len;
+		break;
+	case MRSEQ_READ:
+		n = 1u + reg_len;
+		break;
+	default:
+		return 0;
+	}
+
+	return (n <= left) ? n : 0;
+}
+
+/* done once per blob, max9288_seq_exec() relies on it */
+static int max9288_seq_check(const u8 *ops, size_t size)
+{
+	unsigned int reg_len = 0;
+	size_t pos = 0, n;
+
+	while ((pos < size) && (ops[pos] != MRSEQ_END)) {
+		n = mrseq_op_len(ops + pos, size - pos, reg_len);
+		if (n == 0u)
+			return -EINVAL;
+		if (ops[pos] == MRSEQ_SLAVE) {
+			reg_len = ops[pos + 2u];
+			if ((reg_len == 0u) || (reg_len > MAX_REG_LEN))
+				return -EINVAL;
+		} else if ((ops[pos] != MRSEQ_DELAY) && (reg_len == 0u)) {
+			return -EINVAL;
+		} else if ((ops[pos] == MRSEQ_BURST) && (ops[pos + 1u] == 0u)) {
+			return -EINVAL;
+		}
+		pos += n;
+	}
+
+	return 0;
+}
+
+static int max9288_seq_check_blob(const struct firmware *fw)
+{
+	const struct mrseq_header *hdr = (const void *)fw->data;
+
+	if ((fw->size < sizeof(*hdr)) ||
+	    (memcmp(hdr->magic, MRSEQ_MAGIC, sizeof(hdr->magic)) != 0) ||
+	    (hdr->version != MRSEQ_VERSION) ||
+	    (le32_to_cpu(hdr->size) != fw->size - sizeof(*hdr)))
+		return -EINVAL;
+
+	return max9288_seq_check(fw->data + sizeof(*hdr), fw->size - sizeof(*hdr));
+}
+
+/* writes of max9288_seq_exec() waiting to go out in one i2c_transfer() */
+struct max9288_seq_batch {
+	struct i2c_msg msg[MAX9288_BATCH_MSGS];
+	unsigned int nmsg;
+	u16 slave_addr;
+	u8 *buf;
+};
+
+/* sends what max9288_seq_queue() has pending and releases xfer_lock */
+static int max9288_seq_flush(struct i2c_client *client,
+		struct max9288_seq_batch *batch)
+{
+	struct max9288 *priv = to_max9288(client);
+	unsigned int nmsg = batch->nmsg;
+	int ret;
+
+	if (nmsg == 0u)
+		return 0;
+	client->addr = (batch->slave_addr >> 1);
+	ret = max9288_transfer(client, batch->msg, (int)nmsg);
+	mutex_unlock(&priv->xfer_lock);
+	batch->nmsg = 0;
+	if (ret != (int)nmsg) {
+		max9288_err("burst dev/reg/msgs/ret %x/%x/%u/%d",
+			batch->slave_addr, batch->msg[0].buf[0], nmsg, ret);
+		/* what the batch wrote, if anything, is unknown now */
+		max9288_cache_drop(priv, MAX9288_RMAP_DES, MAX9288_RMAP_SENSOR);
+		max9288_bank_forget(priv);
+		return (ret < 0) ? ret : -EIO;
+	}
+
+	return 0;
+}
+
+/*
+ * Queues one write of n registers from reg on. With coalesce_writes=2
+ * up to MAX9288_BATCH_MSGS of them to one slave share a transfer, across
+ * ops; otherwise each goes out on its own. xfer_lock is held while
+ * writes are pending. The caches take each write as it is queued, so
+ * later writes of the same batch are checked against it;
+ * max9288_seq_flush() drops them if the transfer fails.
+ */
+static int max9288_seq_queue(struct i2c_client *client,
+		struct max9288_seq_batch *batch, u16 slave_addr,
+		unsigned int reg_len, unsigned int reg, const u8 *val,
+		unsigned int n)
+{
+	struct max9288 *priv = to_max9288(client);
+	unsigned int limit = (coalesce_writes >= 2) ? MAX9288_BATCH_MSGS : 1u;
+	struct i2c_msg *msg;
+	unsigned int i;
+	int ret;
+
+	if ((batch->nmsg == limit) ||
+	    ((batch->nmsg > 0u) && (batch->slave_addr != slave_addr))) {
+		ret = max9288_seq_flush(client, batch);
+		if (ret < 0)
+			return ret;
+	}
+	if (batch->nmsg == 0u) {
+		mutex_lock(&priv->xfer_lock);
+		batch->slave_addr = slave_addr;
+		batch->buf = priv->burst_buf;
+	}
+
+	max9288_reg_bytes(batch->buf, reg, reg_len);
+	(void)memcpy(batch->buf + reg_len, val, n);
+	msg = &batch->msg[batch->nmsg];
+	msg->addr = (slave_addr >> 1);
+	msg->flags = 0;
+	msg->len = (u16)(reg_len + n);
+	msg->buf = batch->buf;
+	batch->buf += MAX_REG_LEN + MAX9288_BURST_MAX;
+	++batch->nmsg;
+
+	for (i = 0; i < n; ++i)
+		max9288_cache_update(priv, slave_addr, reg + i, reg_len, val[i]);
+
+	return 0;
+}
+
+/*
+ * count registers from reg on, split into bursts like the tables and
+ * queued on batch; bursts the cache already holds are skipped
+ */
+static int max9288_seq_burst(struct i2c_client *client,
+		struct max9288_seq_batch *batch, u16 slave_addr,
+		unsigned int reg_len, unsigned int reg, const u8 *val,
+		unsigned int count)
+{
+	struct max9288 *priv = to_max9288(client);
+	unsigned int max = (coalesce_writes > 0) ? MAX9288_BURST_MAX : 1u;
+	unsigned int n, i;
+	int ret;
+
+	for (; count > 0u; reg += n, val += n, count -= n) {
+		n = min(count, max);
+		for (i = 0; i < n; ++i)
+			if (!max9288_cache_hit(priv, slave_addr, reg + i,
+					reg_len, val[i]))
+				break;
+		if (i == n) {
+			priv->cache_elided += n;
+			continue;
+		}
+		ret = max9288_seq_queue(client, batch, slave_addr, reg_len,
+			reg, val, n);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+/* ops went through max9288_seq_check() */
+static int max9288_seq_exec(struct i2c_client *client, const char *name,
+		bool blob, const u8 *ops, size_t size)
+{
+	struct max9288 *priv = to_max9288(client);
+	unsigned long xfers = priv->xfer_count, writes = 0;
+	bool batched = (coalesce_writes >= 2);
+	struct max9288_seq_batch batch;
+	ktime_t start = ktime_get();
+	unsigned int reg_len = 0;
+	u16 slave_addr = 0;
+	u8 reg[MAX_REG_LEN];
+	const u8 *op = ops;
+	size_t pos = 0;
+	u8 val;
+	int ret = 0, flushed;
+
+	batch.nmsg = 0;
+	while ((ret >= 0) && (pos < size) && (ops[pos] != MRSEQ_END)) {
+		op = ops + pos;
+		pos += mrseq_op_len(op, size - pos, reg_len);
+		/* only writes to the current slave join the pending batch */
+		if ((op[0] != MRSEQ_BURST) &&
+		    !(batched && (op[0] == MRSEQ_WRITE))) {
+			ret = max9288_seq_flush(client, &batch);
+			if (ret < 0)
+				break;
+		}
+		if ((op[0] != MRSEQ_SLAVE) && (op[0] != MRSEQ_DELAY))
+			(void)memcpy(reg, op + ((op[0] == MRSEQ_BURST) ? 2 : 1),
+				reg_len);
+
+		switch (op[0]) {
+		case MRSEQ_SLAVE:
+			slave_addr = op[1];
+			reg_len = op[2];
+			break;
+		case MRSEQ_WRITE:
+			val = op[1u + reg_len];
+			if (batched)
+				ret = max9288_seq_burst(client, &batch,
+					slave_addr, reg_len,
+					max9288_reg_addr(reg, reg_len), &val, 1);
+			else
+				ret = i2c_write(client, slave_addr, reg,
+					reg_len, &val);
+			++writes;
+			break;
+		case MRSEQ_BURST:
+			ret = max9288_seq_burst(client, &batch, slave_addr,
+				reg_len, max9288_reg_addr(reg, reg_len),
+				op + 2u + reg_len, op[1]);
+			writes += op[1];
+			break;
+		case MRSEQ_DELAY:
+			usleep_range(op[1] * 1000, op[1] * 1000 + 500);
+			break;
+		case MRSEQ_POLL:
+			/* like i2c_poll: running into the timeout is not an error */
+			(void)max9288_poll_reg(client, slave_addr, reg, reg_len,
+				op[1u + reg_len], op[2u + reg_len],
+				op[3u + reg_len]);
+			break;
+		case MRSEQ_READ:
+			ret = i2c_read(client, slave_addr, reg, reg_len, &val);
+			break;
+		default:
+			break;
+		}
+	}
+	flushed = max9288_seq_flush(client, &batch);
+	if (ret >= 0)
+		ret = flushed;
+	if (ret < 0)
+		max9288_err("%s: op %02x at %zu failed %d", name, op[0],
+			(size_t)(op - ops), ret);
+
+	priv->table_legacy_xfers += writes;
+	priv->table_xfers += priv->xfer_count - xfers;
+	max9288_info("%s (%s): %zu bytes, %lu writes in %lu i2c transfers, %lld us",
+		name, blob ? "firmware" : "built-in", size, writes,
+		priv->xfer_count - xfers,
+		ktime_us_delta(ktime_get(), start));
+
+	return (ret < 0) ? ret : 0;
+}
+
+/*
+ * Runs one of max9288_seqs: the blob from /lib/firmware if there is a
+ * valid one, else the built-in version. The blob is looked up once and
+ * kept for later runs, e.g. on resume.
+ */
+static int max9288_seq_run(struct i2c_client *client, enum max9288_seq_id id)
+{
+	struct max9288 *priv = to_max9288(client);
+	const struct max9288_seq *seq = &max9288_seqs[id];
+	const struct firmware *fw = NULL;
+
+	if ((seq_firmware != 0) && !priv->seq_fw_tried[id]) {
+		priv->seq_fw_tried[id] = true;
+		/* no usermode helper: early boot must not wait for it */
+		if (request_firmware_direct(&fw, seq->fw_name, &client->dev) == 0) {
+			if (max9288_seq_check_blob(fw) == 0) {
+				priv->seq_fw[id] = fw;
+			} else {
+				max9288_err("%s malformed, using the built-in one",
+					seq->fw_name);
+				release_firmware(fw);
+			}
+		}
+	}
+
+	fw = (seq_firmware != 0) ? priv->seq_fw[id] : NULL;
+	if (fw != NULL)
+		return max9288_seq_exec(client, seq->fw_name, true,
+			fw->data + sizeof(struct mrseq_header),
+			fw->size - sizeof(struct mrseq_header));
+	if (seq->ops != NULL)
+		return max9288_seq_exec(client, seq->fw_name, false, seq->ops,
+			seq->size);
+
+	return max9288_write_array(client, seq->cmd, seq->len);
+}
+
+/* static int max9288_set_link_config(struct i2c_client *client, u8 *val) */
+/* { */
+/* 	int ret = 0; */
+/* 	u8 link_config_reg = MAX9288_LINK_CONFIG_REG; */
+
+/* 	ret = i2c_write(client, MAX9288_ADDR, &link_config_reg, 1, val); */
+/* 	if (ret != 1) { */
+/* 		max9288_info("link config set fail. ret = %d", ret); */
+/* 		return -EIO; */
+/* 	} */
+
+/* 	return ret; */
+/* } */
+
+int max9288_get_lock_status(struct i2c_client *client, u8 *val)
+{
+	int ret = 0;
+	u8 lock_reg = MAX9288_LOCK_REG;
+
+	ret = i2c_read(client, MAX9288_ADDR, &lock_reg, 1, val);
+	if (ret != 2) {
+		max9288_err("ret=%d", ret);
+		return -EIO;
+	}
+	max9288_info("camera locke val = 0x%x\n",*val);
+	if ((*val & (u8)0x80) != 0u) {
+		max9288_info("camera links are locked");
+	} else {
+		max9288_err("camera links are not locked");
+		ret =  -ENODEV;
+	}
+
+	return ret;
+}
+
+static int max9288_get_link(struct i2c_client *client, u8 *val)
+{
+	int ret = 0;
+	u8 link_reg = MAX9288_LINK_REG;
+
+	ret = i2c_read(client, MAX9288_ADDR, &link_reg, 1, val);
+	if (ret != 2) {
+		max9288_err("ret=%d", ret);
+		ret = -EIO;
+	}
+
+	return ret;
+}
+
+static int max9288_camera_ch_addr_init(struct i2c_client *client,
+	struct reg_val_ops *cmd, unsigned long len, int ch)
+{
+	int ret = 0;
+	unsigned long index = 0;
+
+	/*choose channel*/
+	ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
+		cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
+	if (ret < 0) {
+		max9288_err("dev/reg/val/ret/index %x/%x/%x/%d/%lu",
+			cmd[index].slave_addr, cmd[index].reg[0],
+			cmd[index].val, ret, index);
+		return -1;
+	}
+
+	index = 1;
+	/*read max9271 id use 0x80*/
+	ret = cmd[index].i2c_ops(client, cmd[index].slave_addr,
 		cmd[index].reg, cmd[index].reg_len, &(cmd[index].val));
 	/*
 	 * device is not exist. Maybe device address has been changed but
@@ -2729,11 +2596,31 @@ static int max9288_cab888_4v4_init(struct i2c_client *client)
 	return 0;
 }
 
+static int max9288_cab888_1v1_init(struct i2c_client *client)
+{
+	struct max9288 *priv = to_max9288(client);
+	int ret = 0;
+
+	ret = max9288_seq_run(client, MAX9288_SEQ_1V1_INIT);
+	if (ret < 0)
+		return ret;
+
+	priv->tuning_pending = (defer_tuning != 0);
+	if (!priv->tuning_pending) {
+		ret = max9288_seq_run(client, MAX9288_SEQ_1V1_TUNING);
+		if (ret < 0)
+			return ret;
+	}
+
+	return max9288_seq_run(client, MAX9288_SEQ_1V1_STREAM);
+}
+
 static int max9288_camera_init(struct i2c_client *client)
 {
 	int ret = 0;
 	u8 max9288_id_val = 0;
     u8 lock_reg_val = 0;
+    u8 link_reg_val = 0;
     int read_cnt = 0;
     u32 link_cnt = 0;
     struct max9288 *priv = NULL;
@@ -2752,15 +2639,24 @@ static int max9288_camera_init(struct i2c_client *client)
 		}
     }
 
-    link_cnt = 1;
+	/*
+	 * 4v4 needs a video link from every camera; anything else, or a
+	 * failed read, keeps the 1v1 setup
+	 */
+	ret = max9288_get_link(client, &link_reg_val);
+	if ((ret == 2) && ((link_reg_val & MAX9288_VIDEO_LINK_MASK) ==
+			MAX9288_VIDEO_LINK_MASK))
+		link_cnt = 4;
+	else
+		link_cnt = 1;
+	max9288_info("link_reg_val %x, %u camera linked", link_reg_val,
+		link_cnt);
 	priv = to_max9288(client);
 	priv->link = link_cnt;
 
 	/*init max9288 command*/
 	if (link_cnt == 1U) {
-		ret = max9288_write_array(client,
-			MAX9288_CAB888_1v1_init_cmd,
-			ARRAY_SIZE(MAX9288_CAB888_1v1_init_cmd));
+		ret = max9288_cab888_1v1_init(client);
 	} else if (link_cnt == 4U) {
 		ret = max9288_cab888_4v4_init(client);
 		if (ret < 0)
@@ -2781,6 +2677,14 @@ static int max9288_camera_init(struct i2c_client *client)
     return ret;
 }
 
+/* anything that needs the chain programmed waits for init_work first */
+static int max9288_wait_ready(struct max9288 *priv)
+{
+	int ret = wait_for_completion_interruptible(&priv->init_done);
+
+	return (ret < 0) ? ret : priv->init_ret;
+}
+
 static int max9288_g_mbus_config(struct v4l2_subdev *sd,
 				struct v4l2_mbus_config *cfg)
 {
@@ -2792,7 +2696,21 @@ static int max9288_g_mbus_config(struct v4l2_subdev *sd,
 
 static int max9288_s_stream(struct v4l2_subdev *sd, int enable)
 {
-	return 0;
+	struct i2c_client *client = v4l2_get_subdevdata(sd);
+	struct max9288 *priv = to_max9288(client);
+	int ret = 0;
+
+	priv->streaming = (enable != 0);
+	if (enable == 0)
+		return 0;
+
+	ret = max9288_wait_ready(priv);
+	if ((ret == 0) && priv->tuning_pending) {
+		priv->tuning_pending = false;
+		schedule_work(&priv->tuning_work);
+	}
+
+	return ret;
 }
 
 static int max9288_s_mbus_config(struct v4l2_subdev *sd,
@@ -2877,6 +2795,11 @@ static int max9288_set_fmt(struct v4l2_subdev *sd,
     if (format->pad != 0u)
         return -EINVAL;
 
+	/* priv->link is only known once the chain has been probed */
+	ret = max9288_wait_ready(priv);
+	if (ret < 0)
+		return ret;
+
     //debug("------->>>>in\n");
 	if (fmt == NULL) {
 		/* MIPI CSI could have changed the format, double-check */
@@ -2905,10 +2828,10 @@ static int max9288_set_fmt(struct v4l2_subdev *sd,
 	if (is_testpattern > 0) {
 		/*init max9288 command*/
 		if (priv->link == 1U) {
-			cmd_len = ARRAY_SIZE(MAX9288_CAB888_1v1_init_cmd);
+			cmd_len = ARRAY_SIZE(MAX9288_CAB888_1v1_stream_cmd);
 			skip = 5;
 			ret = max9288_write_array(client,
-				MAX9288_CAB888_1v1_init_cmd + cmd_len - skip,
+				MAX9288_CAB888_1v1_stream_cmd + cmd_len - skip,
 				5);
 		} else if (priv->link == 4U) {
 			cmd_len = ARRAY_SIZE(MAX9288_CAB888_4v4_init_cmd);
@@ -2924,34 +2847,52 @@ static int max9288_set_fmt(struct v4l2_subdev *sd,
 	return ret;
 }
 
+/*
+ * Plain register accesses, nothing else is touched. reg bits 7:0 are the
+ * register, bits 15:8 the 8 bit address of a slave behind the MAX9288
+ * (0 for the MAX9288 itself).
+ */
+static u16 max9288_dbg_slave(const struct v4l2_dbg_register *reg)
+{
+	u16 slave_addr = (u16)((reg->reg >> 8) & 0xFFU);
+
+	return (slave_addr != 0u) ? slave_addr : MAX9288_ADDR;
+}
+
 static int max9288_g_register(struct v4l2_subdev *sd,
 		struct v4l2_dbg_register *reg)
 {
 	struct i2c_client *client = v4l2_get_subdevdata(sd);
-	int ret = 0;
 	u8 val = 0;
-    u8 max9288_reg = (u8)(reg->reg);
-    if (reg == NULL)
-        return -EINVAL;
+	int ret = 0;
 
-    debug("-----> in \n");
-    //ret =  max9288_camera_init(client);
-    if (ret < 0){
-        debug("debug error!!!!!\n");
-        return ret;
-    }
-	max9288_info("read max9288 reg %llx", reg->reg);
-	if (reg->match.type == (u8)0) {
-		ret = i2c_read(client, MAX9288_ADDR, &max9288_reg, 1, &val);
-		if (ret != 2) {
-			max9288_err("ret=%d", ret);
-			return -EIO;
-		}
-        ret = 2;
-		reg->val = 1;
-	}
+	if (reg->match.type != (u8)0)
+		return -EINVAL;
 
-	return ret;
+	ret = max9288_read_burst(client, max9288_dbg_slave(reg), (u8)reg->reg,
+		&val, 1);
+	if (ret < 0)
+		return ret;
+
+	reg->val = val;
+	reg->size = 1;
+	return 0;
+}
+
+static int max9288_s_register(struct v4l2_subdev *sd,
+		const struct v4l2_dbg_register *reg)
+{
+	struct i2c_client *client = v4l2_get_subdevdata(sd);
+	u8 addr = (u8)reg->reg;
+	u8 val = (u8)reg->val;
+	int ret = 0;
+
+	if (reg->match.type != (u8)0)
+		return -EINVAL;
+
+	ret = max9288_write_through(client, max9288_dbg_slave(reg), &addr, 1,
+		&val);
+	return (ret < 0) ? ret : 0;
 }
 
 static const struct v4l2_subdev_video_ops max9288_subdev_video_ops = {
@@ -2963,6 +2904,7 @@ static const struct v4l2_subdev_video_ops max9288_subdev_video_ops = {
 static const struct v4l2_subdev_core_ops max9288_subdev_core_ops = {
 	.s_power	= max9288_s_power,
 	.g_register	= max9288_g_register,
+	.s_register	= max9288_s_register,
 };
 
 static const struct v4l2_subdev_pad_ops max9288_subdev_pad_ops = {
@@ -3033,6 +2975,10 @@ err_vdd1v8:
 }
 #define sensor_register_debug
 #ifdef sensor_register_debug
+/*
+ * register_addr selects the register for the register_* nodes below, for
+ * all readers at once; new tools use /dev/max9288_regs instead.
+ */
 static struct i2c_client *sensor_client = NULL;
 static u8 data;
 static u8 addr[2];
@@ -3102,7 +3048,6 @@ static ssize_t register_store_max96705(struct device *dev, struct device_attribu
     return count;
 }
 //for max20088a
-#define  MAX20088A_ADDR  0x52//0x29
 static ssize_t register_show_max20088a(struct device *dev, struct device_attribute *attr, char *buf)
 {
 	addr[0] = addr[1];
@@ -3122,7 +3067,6 @@ static ssize_t register_store_max20088a(struct device *dev, struct device_attrib
 }
 
 //for max20086
-#define MAX20086A_ADDR 0x50
 ssize_t register_show_max20086a(struct device *dev, struct device_attribute *attr, char *buf)
 {
 	addr[0] = addr[1];
@@ -3145,17 +3089,268 @@ static DEVICE_ATTR(sensor_register_ov10635, 0644, register_show_ov10635, registe
 static DEVICE_ATTR(sensor_register_max9288, 0644, register_show_max9288, register_store_max9288);
 static DEVICE_ATTR(sensor_register_max96705, 0644, register_show_max96705, register_store_max96705);
 static DEVICE_ATTR(register_addr, 0644, addr_show, addr_store);
+
+/*
+ * register_dump: the file offset is the register, bits 15:8 the 8 bit
+ * address of the slave (0 for the MAX9288 itself), as in
+ * VIDIOC_DBG_G_REGISTER. A read stays within one slave and is one
+ * auto-increment burst, e.g. the serializer on link 0 at 0xa2:
+ *   dd if=register_dump bs=256 skip=$((0xa2)) count=1 | xxd
+ * Slaves with 8 bit register addresses only.
+ */
+static ssize_t register_dump_read(struct file *filp, struct kobject *kobj,
+        struct bin_attribute *attr, char *buf, loff_t off, size_t count)
+{
+    u16 slave = (u16)((off >> 8) & 0xFFu);
+    u8 reg = (u8)off;
+    int ret;
+
+    count = min_t(size_t, count, MAX9288_DUMP_LEN - reg);
+    if (slave == 0u)
+        slave = MAX9288_ADDR;
+    ret = max9288_read_burst(sensor_client, slave, reg, (u8 *)buf, count);
+    return (ret < 0) ? ret : (ssize_t)count;
+}
+static BIN_ATTR_RO(register_dump, 0x10000);
+
+/* coalescing check: compare against coalesce_writes=0 on the same tables */
+static ssize_t i2c_stats_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+    struct max9288 *priv = to_max9288(sensor_client);
+    unsigned long count;
+    u64 ns;
+
+    mutex_lock(&priv->xfer_lock);
+    count = priv->xfer_count;
+    ns = priv->xfer_ns;
+    mutex_unlock(&priv->xfer_lock);
+
+    return sprintf(buf, "coalesce_writes=%d table_xfers=%lu one_per_entry=%lu\n"
+            "xfers=%lu avg_ns=%llu\n"
+            "cache_writes=%d elided=%lu\n"
+            "polls=%lu timeouts=%lu waited_us=%llu budget_us=%llu\n"
+            "defer_tuning=%d first_frame_us=%lld tuning_us=%lld pending=%d\n",
+            coalesce_writes, priv->table_xfers, priv->table_legacy_xfers,
+            count, count ? div64_u64(ns, count) : 0ULL,
+            cache_writes, priv->cache_elided,
+            priv->poll_count, priv->poll_timeouts,
+            priv->poll_wait_us, priv->poll_budget_us,
+            defer_tuning, priv->first_frame_us, priv->tuning_us,
+            priv->tuning_pending);
+}
+static DEVICE_ATTR(i2c_stats, 0444, i2c_stats_show, NULL);
 //-------------------------------------------------------------
 static DEVICE_ATTR(linux_register_max20088a, 0644, register_show_max20088a, register_store_max20088a);
 //static DEVICE_ATTR(linux_register_max20086a, 0644, register_show_max20086, register_store_max20086a);
 
 #endif
+/*
+ * /dev/max9288_regs, see max_reg_batch.h. Writes always reach the bus,
+ * one register at a time, and the shadow caches follow them, see
+ * max9288_write_through(); a run of reads shares one i2c_transfer(). All
+ * state lives in the request.
+ */
+static int max9288_batch_check(const struct max_reg_access *acc)
+{
+	if (((acc->op != MAX_REG_OP_READ) && (acc->op != MAX_REG_OP_WRITE)) ||
+	    (acc->reg_len == 0u) || (acc->reg_len > MAX_REG_LEN) ||
+	    (acc->len == 0u) || (acc->len > MAX_REG_VAL_LEN))
+		return -EINVAL;
+
+	return 0;
+}
+
+static u16 max9288_batch_slave(const struct max_reg_access *acc)
+{
+	return (acc->slave == 0u) ? MAX9288_ADDR : acc->slave;
+}
+
+static void max9288_batch_reg(const struct max_reg_access *acc, u16 reg,
+		u8 *buf)
+{
+	if (acc->reg_len == 2u) {
+		buf[0] = (u8)(reg >> 8);
+		buf[1] = (u8)reg;
+	} else {
+		buf[0] = (u8)reg;
+	}
+}
+
+static int max9288_batch_write(struct i2c_client *client,
+		struct max_reg_access *acc)
+{
+	u8 reg[MAX_REG_LEN];
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < acc->len; i++) {
+		max9288_batch_reg(acc, acc->reg + i, reg);
+		ret = max9288_write_through(client, max9288_batch_slave(acc), reg,
+			acc->reg_len, &acc->val[i]);
+		if (ret != 1)
+			return (ret < 0) ? ret : -EIO;
+	}
+
+	return 0;
+}
+
+/* acc[0..n) are checked reads */
+static void max9288_batch_read(struct i2c_client *client,
+		struct max_reg_access *acc, unsigned int n)
+{
+	struct max9288 *priv = to_max9288(client);
+	struct i2c_msg *msg = priv->batch_msg;
+	u8 *buf = priv->batch_buf;
+	unsigned int i;
+	int ret;
+
+	mutex_lock(&priv->xfer_lock);
+	(void)memset(msg, 0, 2u * n * sizeof(*msg));
+	for (i = 0; i < n; i++) {
+		max9288_batch_reg(&acc[i], acc[i].reg, buf);
+		msg[2u * i].addr = max9288_batch_slave(&acc[i]) >> 1;
+		msg[2u * i].flags = 0;
+		msg[2u * i].len = acc[i].reg_len;
+		msg[2u * i].buf = buf;
+		msg[2u * i + 1u].addr = msg[2u * i].addr;
+		msg[2u * i + 1u].flags = I2C_M_RD;
+		msg[2u * i + 1u].len = acc[i].len;
+		msg[2u * i + 1u].buf = buf + MAX_REG_LEN;
+		buf += MAX_REG_LEN + MAX_REG_VAL_LEN;
+	}
+
+	ret = max9288_transfer(client, msg, (int)(2u * n));
+	if (ret == (int)(2u * n)) {
+		for (i = 0; i < n; i++) {
+			(void)memcpy(acc[i].val, msg[2u * i + 1u].buf, acc[i].len);
+			acc[i].result = 0;
+		}
+	}
+	mutex_unlock(&priv->xfer_lock);
+
+	if (ret == (int)(2u * n))
+		return;
+	/* the transfer stops at the first slave not answering: find it */
+	if (n > 1u) {
+		for (i = 0; i < n; i++)
+			max9288_batch_read(client, &acc[i], 1);
+		return;
+	}
+	acc->result = (s16)((ret < 0) ? ret : -EIO);
+}
+
+static long max9288_regs_ioctl(struct file *file, unsigned int cmd,
+		unsigned long arg)
+{
+	struct max9288 *priv = container_of(file->private_data,
+		struct max9288, regs_dev);
+	struct i2c_client *client = v4l2_get_subdevdata(&priv->subdev);
+	void __user *uarg = (void __user *)arg;
+	struct max_reg_batch batch;
+	struct max_reg_access *acc;
+	void __user *uacc;
+	u32 i, n;
+	long ret = 0;
+
+	if (cmd != MAX_REG_IOC_BATCH)
+		return -ENOTTY;
+	if (copy_from_user(&batch, uarg, sizeof(batch)) != 0u)
+		return -EFAULT;
+	if ((batch.count == 0u) || (batch.count > MAX_REG_BATCH_MAX))
+		return -EINVAL;
+
+	uacc = (void __user *)(uintptr_t)batch.accesses;
+	acc = memdup_user(uacc, batch.count * sizeof(*acc));
+	if (IS_ERR(acc))
+		return PTR_ERR(acc);
+
+	for (i = 0; i < batch.count; i += n) {
+		n = 1;
+		acc[i].result = (s16)max9288_batch_check(&acc[i]);
+		if (acc[i].result != 0)
+			continue;
+		if (acc[i].op == MAX_REG_OP_WRITE) {
+			acc[i].result = (s16)max9288_batch_write(client, &acc[i]);
+			continue;
+		}
+		while ((i + n < batch.count) &&
+		       (acc[i + n].op == MAX_REG_OP_READ) &&
+		       (max9288_batch_check(&acc[i + n]) == 0))
+			n++;
+		max9288_batch_read(client, &acc[i], n);
+	}
+
+	batch.failed = 0;
+	for (i = 0; i < batch.count; i++) {
+		if (acc[i].result != 0)
+			batch.failed++;
+	}
+	if ((copy_to_user(uacc, acc, batch.count * sizeof(*acc)) != 0u) ||
+	    (copy_to_user(uarg, &batch, sizeof(batch)) != 0u))
+		ret = -EFAULT;
+	kfree(acc);
+
+	return ret;
+}
+
+static const struct file_operations max9288_regs_fops = {
+	.owner = THIS_MODULE,
+	.unlocked_ioctl = max9288_regs_ioctl,
+	/* struct max_reg_batch has the same layout for 32 bit callers */
+	.compat_ioctl = max9288_regs_ioctl,
+};
+
+/*
+ * Runs after probe has registered the subdev: powers the chain up, waits
+ * for it to settle and programs it. Whatever needs the cameras waits for
+ * init_done, see max9288_wait_ready().
+ */
+static void max9288_init_work(struct work_struct *work)
+{
+	struct max9288 *priv = container_of(work, struct max9288, init_work);
+	struct i2c_client *client = v4l2_get_subdevdata(&priv->subdev);
+	int ret;
+
+	ret = pinctrl_select_state(max9288_pctrl.pinctrl, max9288_pctrl.gpio_state_active);
+	if (ret == 0) {
+		msleep(500);
+		ret = max9288_camera_init(client);
+	}
+	if (ret < 0) {
+		max9288_err("camera init failed %d", ret);
+		if (max9288_s_power(&priv->subdev, 0) < 0)
+			max9288_err("power off failed!");
+	}
+
+	priv->init_ret = (ret < 0) ? ret : 0;
+	priv->first_frame_us = ktime_us_delta(ktime_get(), priv->probe_start);
+	max9288_info("ready (%d) %lld ms after probe%s", priv->init_ret,
+		priv->first_frame_us / 1000,
+		priv->tuning_pending ? ", sensor tuning deferred" : "");
+	complete_all(&priv->init_done);
+}
+
+/* MAX9288_SEQ_1V1_TUNING, queued by max9288_s_stream() */
+static void max9288_tuning_work(struct work_struct *work)
+{
+	struct max9288 *priv = container_of(work, struct max9288, tuning_work);
+	struct i2c_client *client = v4l2_get_subdevdata(&priv->subdev);
+	unsigned long xfers = priv->xfer_count;
+	ktime_t start = ktime_get();
+	int ret;
+
+	ret = max9288_seq_run(client, MAX9288_SEQ_1V1_TUNING);
+	priv->tuning_us = ktime_us_delta(ktime_get(), start);
+	max9288_info("tuning %d: %lu i2c transfers, %lld us, %lld ms after probe",
+		ret, priv->xfer_count - xfers, priv->tuning_us,
+		ktime_us_delta(ktime_get(), priv->probe_start) / 1000);
+}
+
 static int max9288_probe(struct i2c_client *client,
 			const struct i2c_device_id *did)
 {
 	struct max9288 *priv = NULL;
 	struct soc_camera_subdev_desc *ssdd = soc_camera_i2c_to_desc(client);
-	struct v4l2_subdev *subdev = NULL;
     int ret = 0;
     debug("--->>>>in\n");
     if (client->dev.of_node != NULL) {
@@ -3173,6 +3368,11 @@ static int max9288_probe(struct i2c_client *client,
 	priv = devm_kzalloc(&client->dev, sizeof(struct max9288), GFP_KERNEL);
 	if (priv == NULL)
 		return -ENOMEM;
+	mutex_init(&priv->xfer_lock);
+	priv->probe_start = ktime_get();
+	INIT_WORK(&priv->init_work, max9288_init_work);
+	INIT_WORK(&priv->tuning_work, max9288_tuning_work);
+	init_completion(&priv->init_done);
 
 	if (max9288_pinctrl_init(&client->dev) < 0) {
 		max9288_err("%s, %d\n", __func__, __LINE__);
@@ -3182,18 +3382,13 @@ static int max9288_probe(struct i2c_client *client,
 	    max9288_err("%s, %d\n", __func__, __LINE__);
         return -EINVAL;
 	}
-	ret = pinctrl_select_state(max9288_pctrl.pinctrl,max9288_pctrl.gpio_state_active);
-    if (ret < 0) {
-        max9288_err("%s, %d\n", __func__, __LINE__);
-        return ret;
-    }
-    mdelay(500);
-
 	v4l2_i2c_subdev_init(&priv->subdev, client, &max9288_subdev_ops);
 
-	priv->fmt		= &max9288_colour_fmts[0];
+	ret = max9288_regmap_init(client);
+	if (ret < 0)
+		return ret;
 
-	subdev = i2c_get_clientdata(client);
+	priv->fmt		= &max9288_colour_fmts[0];
 
 #ifdef sensor_register_debug
     sensor_client = client;
@@ -3214,6 +3409,14 @@ static int max9288_probe(struct i2c_client *client,
     if (ret) {
         debug("luozh: register_addr probe error....\n");
     }
+    ret = device_create_file(&client->dev, &dev_attr_i2c_stats);
+    if (ret) {
+        debug("i2c_stats probe error....\n");
+    }
+    ret = device_create_bin_file(&client->dev, &bin_attr_register_dump);
+    if (ret) {
+        debug("register_dump probe error....\n");
+    }
     //for max20088 and max20086
     ret = device_create_file(&client->dev, &dev_attr_linux_register_max20088a);
     if (ret) {
@@ -3226,23 +3429,114 @@ static int max9288_probe(struct i2c_client *client,
     }*/
 #endif
 
-	ret =  max9288_camera_init(client);
-    if (ret < 0){
-        max9288_err("max9288 camera init failed!\n");
-        if(max9288_s_power(subdev,0)<0){
-            max9288_err("power off failed!\n");
-        }
-        return ret;
-    }
-    priv->subdev.dev = &client->dev;
+	priv->subdev.dev = &client->dev;
+
+	ret = v4l2_async_register_subdev(&priv->subdev);
+	if (ret < 0)
+		return ret;
+
+	priv->regs_dev.minor = MISC_DYNAMIC_MINOR;
+	priv->regs_dev.name = "max9288_regs";
+	priv->regs_dev.fops = &max9288_regs_fops;
+	priv->regs_dev.parent = &client->dev;
+	priv->regs_dev.mode = 0600;
+	ret = misc_register(&priv->regs_dev);
+	if (ret < 0)
+		max9288_err("max9288_regs not registered %d", ret);
+	priv->regs_registered = (ret == 0);
+
+	schedule_work(&priv->init_work);
+
+	return 0;
+}
+
+
+/*
+ * Whether the links kept their configuration: the 4v4 serializers still
+ * answer on their assigned addresses, the 1v1 serializer still points at
+ * our deserializer (it powers up pointing at 0x90).
+ */
+static bool max9288_links_retained(struct i2c_client *client)
+{
+	struct max9288 *priv = to_max9288(client);
+	u8 reg = MAX9271_DES_ADDR_REG;
+	u8 val = 0;
+
+	if (max9288_get_lock_status(client, &val) != 2)
+		return false;
+	if (priv->link == 4U)
+		return max9288_cab888_4v4_is_init(client) == 0;
+
+	return (i2c_read(client, MAX9271_INIT_ADDR, &reg, 1, &val) == 2) &&
+		(val == MAX9288_ADDR);
+}
+
+static int __maybe_unused max9288_suspend(struct device *dev)
+{
+	struct max9288 *priv = to_max9288(to_i2c_client(dev));
+
+	flush_work(&priv->init_work);
+	flush_work(&priv->tuning_work);
+	/* the rail may go down: the whole cache has to be written back */
+	regcache_mark_dirty(priv->rmap[MAX9288_RMAP_DES].map);
+
+	return 0;
+}
 
-    debug("--->>>>out\n");
-    return v4l2_async_register_subdev(&priv->subdev);
+/*
+ * The deserializer settings do not depend on the links and are restored
+ * from its cache. Serializers and sensor are only reprogrammed if they
+ * lost their state; the init tables then skip the deserializer writes
+ * the sync already made.
+ */
+static int __maybe_unused max9288_resume(struct device *dev)
+{
+	struct i2c_client *client = to_i2c_client(dev);
+	struct max9288 *priv = to_max9288(client);
+	unsigned long xfers = priv->xfer_count;
+	ktime_t start = ktime_get();
+	int ret;
+
+	ret = max9288_cache_sync(&priv->rmap[MAX9288_RMAP_DES]);
+	if (ret < 0) {
+		max9288_err("deserializer cache sync failed %d", ret);
+		max9288_cache_drop(priv, MAX9288_RMAP_DES, MAX9288_RMAP_SENSOR);
+	} else if (max9288_links_retained(client)) {
+		max9288_info("links kept their setup: %lu i2c transfers, %lld us",
+			priv->xfer_count - xfers,
+			ktime_us_delta(ktime_get(), start));
+		return 0;
+	}
+
+	max9288_cache_drop(priv, MAX9288_RMAP_SER0, MAX9288_RMAP_SENSOR);
+	max9288_bank_forget(priv);
+	ret = max9288_camera_init(client);
+	max9288_info("re-init %d: %lu i2c transfers, %lld us", ret,
+		priv->xfer_count - xfers, ktime_us_delta(ktime_get(), start));
+	/* still streaming: no s_stream(1) follows to queue the tuning */
+	if ((ret >= 0) && priv->streaming && priv->tuning_pending) {
+		priv->tuning_pending = false;
+		schedule_work(&priv->tuning_work);
+	}
+
+	return (ret < 0) ? ret : 0;
 }
 
+static SIMPLE_DEV_PM_OPS(max9288_pm_ops, max9288_suspend, max9288_resume);
+
 static int max9288_remove(struct i2c_client *client)
 {
 	struct soc_camera_subdev_desc *ssdd = soc_camera_i2c_to_desc(client);
+	struct max9288 *priv = to_max9288(client);
+	int i;
+
+	if (priv->regs_registered)
+		misc_deregister(&priv->regs_dev);
+	flush_work(&priv->init_work);
+	cancel_work_sync(&priv->tuning_work);
+	v4l2_async_unregister_subdev(&priv->subdev);
+	for (i = 0; i < MAX9288_SEQ_COUNT; ++i)
+		release_firmware(priv->seq_fw[i]);
 
 	if (ssdd->free_bus != NULL)
 		ssdd->free_bus(ssdd);
@@ -3264,6 +3558,7 @@ static struct i2c_driver max9288_i2c_driver = {
 		.name = "max9288",
 		.of_match_table = max9288_camera_of_match,
 		.probe_type = PROBE_PREFER_ASYNCHRONOUS,
+		.pm = &max9288_pm_ops,
 	},
 	.probe		= max9288_probe,
 	.remove		= max9288_remove,
@@ -3272,6 +3567,16 @@ static struct i2c_driver max9288_i2c_driver = {
 
 module_param(is_testpattern, int, 0644);
 MODULE_PARM_DESC(is_testpattern, "Whether the MAX9288 get test pattern data");
+module_param(coalesce_writes, int, 0644);
+MODULE_PARM_DESC(coalesce_writes, "Register tables: 0 one transfer per write, 1 auto-increment bursts, 2 bursts batched per slave");
+module_param(verify_writes, int, 0644);
+MODULE_PARM_DESC(verify_writes, "Read back deserializer table writes: 0 off, 1 after each write, 2 once per table");
+module_param(cache_writes, int, 0644);
+MODULE_PARM_DESC(cache_writes, "Skip writes the register cache already holds (default 1)");
+module_param(defer_tuning, int, 0644);
+MODULE_PARM_DESC(defer_tuning, "1v1: write the sensor firmware and tuning after streaming has started (default 1)");
+module_param(seq_firmware, int, 0644);
+MODULE_PARM_DESC(seq_firmware, "Load the init sequences from /lib/firmware when present (default 1)");
 module_i2c_driver(max9288_i2c_driver);
 
 MODULE_DESCRIPTION("MAXIM Camera driver");
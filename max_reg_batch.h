@@ -0,0 +1,48 @@
+/*
+ * Batched register access for the max9286 and max9288 drivers
+ *
+ * The drivers register /dev/max9286_regs and /dev/max9288_regs. One
+ * MAX_REG_IOC_BATCH ioctl runs a whole array of accesses in order, and
+ * consecutive reads go out as a single i2c_transfer(). Everything a
+ * request needs travels in the request, so unlike the register_addr +
+ * register_* sysfs pair several tools can use the node at the same time.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#ifndef MAX_REG_BATCH_H
+#define MAX_REG_BATCH_H
+
+#include <linux/types.h>
+#include <linux/ioctl.h>
+
+/* accesses in one MAX_REG_IOC_BATCH */
+#define MAX_REG_BATCH_MAX 64
+/* value bytes in one access */
+#define MAX_REG_VAL_LEN 8
+
+#define MAX_REG_OP_READ 0
+#define MAX_REG_OP_WRITE 1
+
+struct max_reg_access {
+	__u8 slave;		/* 8 bit I2C address, 0: the deserializer */
+	__u8 op;		/* MAX_REG_OP_READ or MAX_REG_OP_WRITE */
+	__u8 reg_len;		/* register address bytes, 1 or 2 */
+	__u8 len;		/* value bytes, 1 .. MAX_REG_VAL_LEN, auto-increment */
+	__u16 reg;
+	__s16 result;		/* out: 0 or a negative errno */
+	__u8 val[MAX_REG_VAL_LEN];
+};
+
+struct max_reg_batch {
+	__u32 count;		/* entries in accesses, 1 .. MAX_REG_BATCH_MAX */
+	__u32 failed;		/* out: entries whose result is not 0 */
+	__u64 accesses;		/* user pointer to struct max_reg_access[count] */
+};
+
+#define MAX_REG_IOC_MAGIC 'M'
+#define MAX_REG_IOC_BATCH _IOWR(MAX_REG_IOC_MAGIC, 0x01, struct max_reg_batch)
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * Compact register sequences for the max9288 init tables
+ *
+ * A sequence is a stream of byte opcodes. An access op addresses the slave
+ * and register width picked by the last MRSEQ_SLAVE, and its register
+ * goes out big endian in reg_len bytes. A single write takes 3 or 4
+ * bytes, against 24 for a struct reg_val_ops entry.
+ *
+ *   MRSEQ_END                              stop, optional at the end
+ *   MRSEQ_SLAVE  slave reg_len             8 bit I2C address, 1 or 2
+ *   MRSEQ_WRITE  reg val
+ *   MRSEQ_BURST  count reg val[count]      count registers from reg on
+ *   MRSEQ_DELAY  ms
+ *   MRSEQ_POLL   reg mask val timeout_ms   like an i2c_poll table entry
+ *   MRSEQ_READ   reg                       value is discarded
+ *
+ * Blobs in /lib/firmware start with struct mrseq_header. Built-in
+ * sequences are plain op streams written with the macros below.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#ifndef MAX_REG_SEQ_H
+#define MAX_REG_SEQ_H
+
+#include <linux/types.h>
+
+#define MRSEQ_END 0x00
+#define MRSEQ_SLAVE 0x01
+#define MRSEQ_WRITE 0x02
+#define MRSEQ_BURST 0x03
+#define MRSEQ_DELAY 0x04
+#define MRSEQ_POLL 0x05
+#define MRSEQ_READ 0x06
+
+#define MRSEQ_MAGIC "MRSQ"
+#define MRSEQ_VERSION 1
+
+struct mrseq_header {
+	__u8 magic[4];		/* MRSEQ_MAGIC, no terminating 0 */
+	__u8 version;		/* MRSEQ_VERSION */
+	__u8 reserved[3];
+	__le32 size;		/* bytes of ops after the header */
+};
+
+#define MRSEQ_R8(reg) ((reg) & 0xFF)
+#define MRSEQ_R16(reg) (((reg) >> 8) & 0xFF), ((reg) & 0xFF)
+
+#define MRSEQ_SLAVE_OP(slave, reg_len) MRSEQ_SLAVE, (slave), (reg_len)
+#define MRSEQ_W8(reg, val) MRSEQ_WRITE, MRSEQ_R8(reg), (val)
+#define MRSEQ_W16(reg, val) MRSEQ_WRITE, MRSEQ_R16(reg), (val)
+/* followed by count values */
+#define MRSEQ_BURST8(reg, count) MRSEQ_BURST, (count), MRSEQ_R8(reg)
+#define MRSEQ_BURST16(reg, count) MRSEQ_BURST, (count), MRSEQ_R16(reg)
+#define MRSEQ_DELAY_OP(ms) MRSEQ_DELAY, (ms)
+#define MRSEQ_POLL8(reg, mask, val, ms) MRSEQ_POLL, MRSEQ_R8(reg), (mask), (val), (ms)
+#define MRSEQ_POLL16(reg, mask, val, ms) MRSEQ_POLL, MRSEQ_R16(reg), (mask), (val), (ms)
+#define MRSEQ_READ8(reg) MRSEQ_READ, MRSEQ_R8(reg)
+#define MRSEQ_READ16(reg) MRSEQ_READ, MRSEQ_R16(reg)
+
+#endif
@@ -236,15 +236,16 @@ def PrepareRecord():
     cam_res=cam_result.read()
     for camDev in cam_res.splitlines():
         #preview
-        gladuis_sub = "gst-launch-1.0 v4l2src device='/dev/%s'  ! videoconvert ! jpegenc !  tcpserversink port=8554 host=0.0.0.0"%camDev
+        #gladuis_sub = "gst-launch-1.0 v4l2src device='/dev/%s'  ! videoconvert ! jpegenc !  tcpserversink port=8554 host=0.0.0.0"%camDev
+        gladuis_sub = "/flash/CameraCapture -p 8554 -j 4 %s"%camDev.replace('video', '')
         gladuis = "ssh -f -n root@172.20.1.11 " + '\"' +  gladuis_sub + '\"' + "> /dev/null 2>&1 &"
         #print (gladuis)
         #save yuv data
         #gladuis_save = "gst-launch-1.0 v4l2src device='/dev/%s' !  tcpserversink port=8554 host=0.0.0.0"%camDev
         #gladuis_save_cmd = "ssh -f -n root@172.20.1.11 " + '\"' +  gladuis_save + '\"' + "> /dev/null 2>&1 &"
 
-    #1 check gst-launch-1.0 process
-    gstreamer = '''ssh root@172.20.1.11 "ps -A | grep "gst-launch-1.0"" | awk '{print $1}' '''
+    #1 check gst-launch-1.0 / CameraCapture preview process
+    gstreamer = '''ssh root@172.20.1.11 "ps -A | grep -e "gst-launch-1.0" -e "CameraCapture"" | awk '{print $1}' '''
     gstr_result = os.popen(gstreamer)
     gstr_res = gstr_result.read()
     for gstr_line in gstr_res.splitlines():
@@ -0,0 +1,683 @@
+/*
+ * GMSL chip models, the simulated I2C adapter and the phase accounting,
+ * see gmsl.h. Not built with -finstrument-functions.
+ *
+ * Bus time follows the wire: a start or repeated start and a stop are one
+ * bit time each, every byte is nine with its ACK. A message the slave
+ * does not ACK ends the transfer after its address byte, like a NACK on
+ * a real adapter.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include <getopt.h>
+
+#include "gmsl.h"
+
+#define SER_POWER_ON_ADDR 0x80
+#define SER_DES_ADDR_REG 0x01
+#define SER_CTL_REG 0x04
+#define SER_SEREN 0x80
+#define SER_CLINKEN 0x40
+#define SER_LINKS (SER_SEREN | SER_CLINKEN)
+#define SER_SRC_A 0x09
+#define SER_DST_A 0x0A
+#define SER_SRC_B 0x0B
+#define SER_DST_B 0x0C
+
+#define DES_ID_REG 0x1E
+#define DES_LINK_EN_REG 0x00
+#define DES_CC_REG 0x0A
+
+#define OV490_BANK_HI 0xFFFD
+#define OV490_BANK_LO 0xFFFE
+#define SENSOR_RESET_REG 0x0103
+
+#define MAX_TARGETS (GMSL_LINKS * 2)
+#define OV490_BANKS 16
+
+struct gmsl_chip {
+	const char *name;
+	enum gmsl_kind kind;
+	u8 addr;
+	u8 power_on_addr;
+	bool present;
+	u16 ptr;		/* register pointer, auto-increments */
+	u8 regs[256];
+	u8 *mem;		/* GMSL_SENSOR: 64 KiB */
+	/* GMSL_OV490: 0xFFFD/0xFFFE and the banks touched so far */
+	u8 bank[2];
+	unsigned int nbanks;
+	u16 bank_id[OV490_BANKS];
+	u8 *bank_mem[OV490_BANKS];
+	/* GMSL_SER: when SEREN last went up */
+	s64 seren_ns;
+};
+
+struct gmsl_link {
+	struct gmsl_chip ser;
+	struct gmsl_chip sensor;
+};
+
+struct gmsl_count gmsl_count;
+unsigned int gmsl_khz = 400;
+int sim_cameras = -1;
+unsigned int sim_lock_us = 3000;
+
+static struct gmsl_cfg cfg;
+static struct gmsl_chip des;
+static struct gmsl_chip local[2];
+static struct gmsl_link links[GMSL_LINKS];
+
+static unsigned int chip_reg_len(const struct gmsl_chip *c)
+{
+	return ((c->kind == GMSL_SENSOR) || (c->kind == GMSL_OV490)) ? 2u : 1u;
+}
+
+static void sensor_defaults(struct gmsl_chip *c)
+{
+	memset(c->mem, 0, 0x10000);
+	/* OV10635: PID/VER, what the driver checks after a soft reset */
+	c->mem[0x300A] = 0xA6;
+	c->mem[0x300B] = 0x35;
+}
+
+static void ov490_reset(struct gmsl_chip *c)
+{
+	unsigned int i;
+
+	for (i = 0; i < c->nbanks; i++)
+		memset(c->bank_mem[i], 0, 0x10000);
+	c->bank[0] = 0;
+	c->bank[1] = 0;
+}
+
+static void chip_power_on(struct gmsl_chip *c)
+{
+	c->addr = c->power_on_addr;
+	c->ptr = 0;
+	memset(c->regs, 0, sizeof(c->regs));
+	switch (c->kind) {
+	case GMSL_DES:
+		c->regs[DES_ID_REG] = cfg.des_id;
+		c->regs[DES_LINK_EN_REG] = cfg.link_ctrl ? 0xEF : 0x00;
+		c->regs[DES_CC_REG] = 0xFF;
+		break;
+	case GMSL_SER:
+		c->regs[0x00] = c->addr;
+		c->regs[SER_DES_ADDR_REG] = 0x90;
+		/* serial link and config link enabled, as strapped */
+		c->regs[SER_CTL_REG] = 0x87;
+		c->seren_ns = sim_now_ns;
+		break;
+	case GMSL_SENSOR:
+		if (c->mem == NULL)
+			c->mem = calloc(1, 0x10000);
+		sensor_defaults(c);
+		break;
+	case GMSL_OV490:
+		ov490_reset(c);
+		break;
+	case GMSL_PLAIN:
+		break;
+	}
+}
+
+static void chip_init(struct gmsl_chip *c, const char *name,
+		enum gmsl_kind kind, u8 addr, bool present)
+{
+	c->name = name;
+	c->kind = kind;
+	c->power_on_addr = addr;
+	c->present = present;
+	if (present)
+		chip_power_on(c);
+}
+
+void gmsl_setup(const struct gmsl_cfg *config)
+{
+	unsigned int i;
+
+	cfg = *config;
+	chip_init(&des, cfg.des_name, GMSL_DES, cfg.des_addr, true);
+	for (i = 0; i < ARRAY_SIZE(local); i++)
+		chip_init(&local[i], "local", GMSL_PLAIN, cfg.local_addr[i],
+			cfg.local_addr[i] != 0u);
+	for (i = 0; i < GMSL_LINKS; i++) {
+		chip_init(&links[i].ser, cfg.ser_name, GMSL_SER,
+			SER_POWER_ON_ADDR, i < cfg.cameras);
+		chip_init(&links[i].sensor, cfg.sensor_name, cfg.sensor_kind,
+			cfg.sensor_addr, i < cfg.cameras);
+	}
+}
+
+void gmsl_power_cycle_link(unsigned int link)
+{
+	if (!links[link].ser.present)
+		return;
+	chip_power_on(&links[link].ser);
+	chip_power_on(&links[link].sensor);
+}
+
+void gmsl_power_cycle(void)
+{
+	unsigned int i;
+
+	chip_power_on(&des);
+	for (i = 0; i < ARRAY_SIZE(local); i++)
+		if (local[i].present)
+			chip_power_on(&local[i]);
+	for (i = 0; i < GMSL_LINKS; i++)
+		gmsl_power_cycle_link(i);
+}
+
+/* the serial link carries video once it has been up for lock_us */
+static bool link_video(unsigned int i)
+{
+	const struct gmsl_chip *ser = &links[i].ser;
+
+	return ser->present && ((ser->regs[SER_CTL_REG] & SER_SEREN) != 0u) &&
+		(sim_now_ns - ser->seren_ns >= (s64)cfg.lock_us * 1000);
+}
+
+/* the control channel runs over either link */
+static bool link_up(unsigned int i)
+{
+	const struct gmsl_chip *ser = &links[i].ser;
+
+	return ser->present && ((ser->regs[SER_CTL_REG] & SER_LINKS) != 0u);
+}
+
+/* 0x49[7:4] report the configuration link, not the serial link */
+static bool link_config(unsigned int i)
+{
+	const struct gmsl_chip *ser = &links[i].ser;
+
+	return ser->present && ((ser->regs[SER_CTL_REG] & SER_CLINKEN) != 0u);
+}
+
+/* can the local bus reach the serializer of link i */
+static bool link_open(unsigned int i)
+{
+	u8 cc = des.regs[DES_CC_REG];
+
+	if (!link_up(i))
+		return false;
+	if (!cfg.link_ctrl)
+		return i == 0u;
+
+	return ((cc >> i) & (cc >> (i + 4u)) & 1u) != 0u;
+}
+
+static u8 des_link_reg(void)
+{
+	unsigned int i;
+	u8 val = 0;
+
+	for (i = 0; i < GMSL_LINKS; i++) {
+		if (link_config(i))
+			val |= (u8)(0x10u << i);
+		if (link_video(i))
+			val |= (u8)(1u << i);
+	}
+
+	return val;
+}
+
+static bool des_locked(void)
+{
+	u8 en = cfg.link_ctrl ? (des.regs[DES_LINK_EN_REG] & 0x0Fu) : 0x01u;
+	unsigned int i;
+
+	if (en == 0u)
+		return false;
+	for (i = 0; i < GMSL_LINKS; i++)
+		if (((en >> i) & 1u) && !link_video(i))
+			return false;
+
+	return true;
+}
+
+static u8 *ov490_mem(struct gmsl_chip *c, bool alloc)
+{
+	u16 id = (u16)((c->bank[0] << 8) | c->bank[1]);
+	unsigned int i;
+
+	for (i = 0; i < c->nbanks; i++)
+		if (c->bank_id[i] == id)
+			return c->bank_mem[i];
+	if (!alloc)
+		return NULL;
+	if (c->nbanks == OV490_BANKS) {
+		fprintf(stderr, "sim: %s: more than %d banks\n", c->name,
+			OV490_BANKS);
+		exit(1);
+	}
+	c->bank_id[c->nbanks] = id;
+	c->bank_mem[c->nbanks] = calloc(1, 0x10000);
+
+	return c->bank_mem[c->nbanks++];
+}
+
+/* a register as a read would return it */
+static u8 chip_read(struct gmsl_chip *c, u16 reg)
+{
+	u8 *mem;
+
+	switch (c->kind) {
+	case GMSL_DES:
+		if (reg == cfg.link_reg)
+			return des_link_reg();
+		if (reg == cfg.lock_reg)
+			return (u8)((c->regs[reg] & 0x7Fu) |
+				(des_locked() ? 0x80u : 0u));
+		return c->regs[reg & 0xFFu];
+	case GMSL_SER:
+		return (reg == 0u) ? c->addr : c->regs[reg & 0xFFu];
+	case GMSL_SENSOR:
+		return c->mem[reg];
+	case GMSL_OV490:
+		if ((reg == OV490_BANK_HI) || (reg == OV490_BANK_LO))
+			return c->bank[reg - OV490_BANK_HI];
+		mem = ov490_mem(c, false);
+		return (mem != NULL) ? mem[reg] : 0u;
+	default:
+		return c->regs[reg & 0xFFu];
+	}
+}
+
+static void chip_write(struct gmsl_chip *c, u16 reg, u8 val)
+{
+	u8 old;
+
+	switch (c->kind) {
+	case GMSL_DES:
+		if (reg != DES_ID_REG)
+			c->regs[reg & 0xFFu] = val;
+		break;
+	case GMSL_SER:
+		old = c->regs[SER_CTL_REG];
+		c->regs[reg & 0xFFu] = val;
+		if (reg == 0u)
+			c->addr = val;
+		if ((reg == SER_CTL_REG) && (val & SER_SEREN) &&
+		    !(old & SER_SEREN))
+			c->seren_ns = sim_now_ns;
+		break;
+	case GMSL_SENSOR:
+		if ((reg == SENSOR_RESET_REG) && (val & 1u)) {
+			sensor_defaults(c);
+			break;
+		}
+		c->mem[reg] = val;
+		break;
+	case GMSL_OV490:
+		if ((reg == OV490_BANK_HI) || (reg == OV490_BANK_LO)) {
+			gmsl_count.bank_writes++;
+			if (c->bank[reg - OV490_BANK_HI] == val)
+				gmsl_count.bank_same++;
+			c->bank[reg - OV490_BANK_HI] = val;
+			break;
+		}
+		ov490_mem(c, true)[reg] = val;
+		break;
+	default:
+		c->regs[reg & 0xFFu] = val;
+		break;
+	}
+}
+
+/* 8 bit addresses of the chips answering to a8, local chips first */
+static unsigned int route(u8 a8, struct gmsl_chip **out)
+{
+	struct gmsl_chip *ser;
+	unsigned int i, n = 0;
+	u8 a;
+
+	if (a8 == des.addr) {
+		out[0] = &des;
+		return 1;
+	}
+	for (i = 0; i < ARRAY_SIZE(local); i++)
+		if (local[i].present && (a8 == local[i].addr)) {
+			out[0] = &local[i];
+			return 1;
+		}
+
+	for (i = 0; i < GMSL_LINKS; i++) {
+		if (!link_open(i))
+			continue;
+		ser = &links[i].ser;
+		a = a8;
+		if ((ser->regs[SER_SRC_A] != 0u) && (a8 == ser->regs[SER_SRC_A]))
+			a = ser->regs[SER_DST_A];
+		else if ((ser->regs[SER_SRC_B] != 0u) &&
+			 (a8 == ser->regs[SER_SRC_B]))
+			a = ser->regs[SER_DST_B];
+		if (a == ser->addr)
+			out[n++] = ser;
+		else if (links[i].sensor.present && (a == links[i].sensor.addr))
+			out[n++] = &links[i].sensor;
+	}
+
+	return n;
+}
+
+static void msg_write(struct gmsl_chip *c, const u8 *buf, unsigned int len)
+{
+	unsigned int rl = chip_reg_len(c);
+	unsigned int i;
+
+	if (len < rl)
+		return;
+	c->ptr = (rl == 2u) ? (u16)((buf[0] << 8) | buf[1]) : buf[0];
+	for (i = rl; i < len; i++) {
+		chip_write(c, c->ptr, buf[i]);
+		c->ptr = (rl == 2u) ? (u16)(c->ptr + 1u) : (u8)(c->ptr + 1u);
+	}
+}
+
+static u8 msg_read_byte(struct gmsl_chip *c)
+{
+	u8 val = chip_read(c, c->ptr);
+
+	c->ptr = (chip_reg_len(c) == 2u) ? (u16)(c->ptr + 1u) : (u8)(c->ptr + 1u);
+
+	return val;
+}
+
+static void bus_time(unsigned long long bits)
+{
+	gmsl_count.bits += bits;
+	sim_now_ns += (s64)(bits * 1000000ull / gmsl_khz);
+}
+
+int i2c_transfer(struct i2c_adapter *adap, struct i2c_msg *msgs, int num)
+{
+	struct gmsl_chip *to[MAX_TARGETS];
+	unsigned long long bits = 1;	/* stop */
+	unsigned int n, i, j;
+	int k, ret = num;
+	u8 val;
+
+	gmsl_count.xfers++;
+	for (k = 0; k < num; k++) {
+		struct i2c_msg *m = &msgs[k];
+
+		gmsl_count.msgs++;
+		n = route((u8)(m->addr << 1), to);
+		if (n == 0u) {
+			bits += 1u + 9u;
+			gmsl_count.bytes++;
+			gmsl_count.nacks++;
+			ret = -ENXIO;
+			break;
+		}
+		bits += 1u + 9u * (1u + m->len);
+		gmsl_count.bytes += 1u + m->len;
+		if (!(m->flags & I2C_M_RD)) {
+			for (i = 0; i < n; i++)
+				msg_write(to[i], m->buf, m->len);
+			continue;
+		}
+		/* open drain: several slaves answering read as the AND */
+		for (j = 0; j < m->len; j++) {
+			val = 0xFF;
+			for (i = 0; i < n; i++)
+				val &= msg_read_byte(to[i]);
+			m->buf[j] = val;
+		}
+	}
+	bus_time(bits);
+
+	return ret;
+}
+
+/* phases */
+
+#define MAX_PHASES 64
+#define MAX_NODES 256
+#define MAX_DEPTH 32
+
+struct phase_node {
+	int phase;
+	int parent;
+	int child;
+	int sibling;
+	unsigned long calls;
+	struct gmsl_count sum;
+	s64 ns;
+};
+
+struct phase_frame {
+	int node;
+	struct gmsl_count at;
+	s64 at_ns;
+};
+
+static struct {
+	void *fn;
+	const char *name;
+} phases[MAX_PHASES];
+static unsigned int nphases;
+
+static struct phase_node nodes[MAX_NODES];
+static unsigned int nnodes;
+static struct phase_frame stack[MAX_DEPTH];
+static int depth;
+static bool recording;
+static const char *report_title;
+static struct gmsl_count report_at;
+static s64 report_at_ns;
+
+void gmsl_phase(void *fn, const char *name)
+{
+	if (nphases == MAX_PHASES) {
+		fprintf(stderr, "sim: too many phases\n");
+		exit(1);
+	}
+	phases[nphases].fn = fn;
+	phases[nphases].name = name;
+	nphases++;
+}
+
+static int phase_find(void *fn)
+{
+	unsigned int i;
+
+	for (i = 0; i < nphases; i++)
+		if (phases[i].fn == fn)
+			return (int)i;
+
+	return -1;
+}
+
+static int node_get(int parent, int phase)
+{
+	int *link = (parent < 0) ? NULL : &nodes[parent].child;
+	int i;
+
+	if (parent < 0) {
+		for (i = 0; i < (int)nnodes; i++)
+			if ((nodes[i].parent < 0) && (nodes[i].phase == phase))
+				return i;
+	} else {
+		for (i = *link; i >= 0; i = nodes[i].sibling)
+			if (nodes[i].phase == phase)
+				return i;
+	}
+	if (nnodes == MAX_NODES) {
+		fprintf(stderr, "sim: phase tree too large\n");
+		exit(1);
+	}
+	i = (int)nnodes++;
+	memset(&nodes[i], 0, sizeof(nodes[i]));
+	nodes[i].phase = phase;
+	nodes[i].parent = parent;
+	nodes[i].child = -1;
+	nodes[i].sibling = -1;
+	if (link != NULL) {
+		/* append, children print in the order they first ran */
+		while (*link >= 0)
+			link = &nodes[*link].sibling;
+		*link = i;
+	}
+
+	return i;
+}
+
+static void count_add(struct gmsl_count *sum, const struct gmsl_count *now,
+		const struct gmsl_count *at)
+{
+	sum->xfers += now->xfers - at->xfers;
+	sum->msgs += now->msgs - at->msgs;
+	sum->bytes += now->bytes - at->bytes;
+	sum->bits += now->bits - at->bits;
+	sum->wait_ns += now->wait_ns - at->wait_ns;
+	sum->nacks += now->nacks - at->nacks;
+	sum->bank_writes += now->bank_writes - at->bank_writes;
+	sum->bank_same += now->bank_same - at->bank_same;
+}
+
+void __attribute__((no_instrument_function))
+__cyg_profile_func_enter(void *fn, void *site)
+{
+	int phase;
+
+	if (!recording)
+		return;
+	phase = phase_find(fn);
+	if (phase < 0)
+		return;
+	if (depth == MAX_DEPTH) {
+		fprintf(stderr, "sim: phases nest too deep\n");
+		exit(1);
+	}
+	stack[depth].node = node_get((depth > 0) ? stack[depth - 1].node : -1,
+		phase);
+	stack[depth].at = gmsl_count;
+	stack[depth].at_ns = sim_now_ns;
+	nodes[stack[depth].node].calls++;
+	depth++;
+}
+
+void __attribute__((no_instrument_function))
+__cyg_profile_func_exit(void *fn, void *site)
+{
+	struct phase_node *node;
+
+	if (!recording || (depth == 0) || (phase_find(fn) < 0))
+		return;
+	depth--;
+	node = &nodes[stack[depth].node];
+	count_add(&node->sum, &gmsl_count, &stack[depth].at);
+	node->ns += sim_now_ns - stack[depth].at_ns;
+}
+
+void gmsl_report_begin(const char *title)
+{
+	nnodes = 0;
+	depth = 0;
+	report_title = title;
+	report_at = gmsl_count;
+	report_at_ns = sim_now_ns;
+	recording = true;
+}
+
+static double bus_ms(unsigned long long bits, unsigned int khz)
+{
+	return (double)bits / khz;
+}
+
+static void report_line(const char *name, int indent, unsigned long calls,
+		const struct gmsl_count *c, s64 ns)
+{
+	printf("  %*s%-*s %5lu %6lu %6lu %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+		indent, "", 38 - indent, name, calls, c->xfers, c->bytes,
+		bus_ms(c->bits, 100), bus_ms(c->bits, 400),
+		bus_ms(c->bits, 1000), c->wait_ns / 1e6, ns / 1e6);
+}
+
+static void report_node(int i, int indent)
+{
+	for (; i >= 0; i = nodes[i].sibling) {
+		report_line(phases[nodes[i].phase].name, indent, nodes[i].calls,
+			&nodes[i].sum, nodes[i].ns);
+		report_node(nodes[i].child, indent + 2);
+	}
+}
+
+void gmsl_report_end(void)
+{
+	struct gmsl_count total = { 0 };
+	unsigned int i;
+
+	recording = false;
+	count_add(&total, &gmsl_count, &report_at);
+
+	printf("%s\n", report_title);
+	printf("  %-38s %5s %6s %6s %8s %8s %8s %8s %8s\n", "phase", "calls",
+		"xfers", "bytes", "100k ms", "400k ms", "1M ms", "wait ms",
+		"total ms");
+	for (i = 0; i < nnodes; i++)
+		if (nodes[i].parent < 0)
+			report_node((int)i, 0);
+	report_line("(all)", 0, 1, &total, sim_now_ns - report_at_ns);
+	if (total.nacks != 0u)
+		printf("  %lu messages not acknowledged\n", total.nacks);
+	if (total.bank_writes != 0u)
+		printf("  OV490 bank selects: %lu, %lu of them to the bank already selected\n",
+			total.bank_writes, total.bank_same);
+	printf("  total ms: virtual time at %u kHz\n\n", gmsl_khz);
+}
+
+/* command line */
+
+static const char usage[] =
+	"usage: %s [-v] [-k kHz] [-c cameras] [-l lock_us] [-f fw_dir]\n"
+	"          [-p param=value]...\n"
+	"  -v  driver log on stdout\n"
+	"  -k  bus clock for the virtual time line, default 400\n"
+	"  -c  cameras connected, links 0 to n - 1\n"
+	"  -l  serial link enable to video lock, default 3000 us\n"
+	"  -f  directory request_firmware() looks in, default none\n"
+	"  -p  set a module parameter before probing\n";
+
+void sim_parse_args(int argc, char **argv)
+{
+	int opt;
+
+	while ((opt = getopt(argc, argv, "vk:c:l:f:p:h")) != -1) {
+		switch (opt) {
+		case 'v':
+			sim_verbose = 1;
+			break;
+		case 'k':
+			gmsl_khz = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			sim_cameras = (int)strtol(optarg, NULL, 0);
+			break;
+		case 'l':
+			sim_lock_us = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			sim_fw_dir = optarg;
+			break;
+		case 'p':
+			if (sim_param_set(optarg) < 0)
+				exit(2);
+			break;
+		default:
+			fprintf(stderr, usage, argv[0]);
+			exit(2);
+		}
+	}
+	if ((gmsl_khz == 0u) || (sim_cameras == 0) ||
+	    (sim_cameras > GMSL_LINKS) || (optind != argc)) {
+		fprintf(stderr, usage, argv[0]);
+		exit(2);
+	}
+}
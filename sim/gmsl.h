@@ -0,0 +1,95 @@
+/*
+ * GMSL chip models behind the simulated I2C adapter
+ *
+ * One deserializer on the local bus, up to four links, each with a
+ * serializer and the sensor or ISP behind it. Modelled are what the init
+ * tables depend on: the serializer address remap through its register
+ * 0x00 and the I2C translations in 0x09-0x0C, the deserializer's control
+ * channel select in 0x0A, link detect, video lock and the serializer's
+ * 0x04, the OV490 bank registers 0xFFFD/0xFFFE and the sensors' soft
+ * reset. Everything else is plain memory with auto-increment.
+ *
+ * Addresses are 8 bit, as in the driver tables.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#ifndef SIM_GMSL_H
+#define SIM_GMSL_H
+
+#include "kernel.h"
+
+#define GMSL_LINKS 4
+
+enum gmsl_kind {
+	GMSL_DES,
+	GMSL_SER,
+	GMSL_SENSOR,	/* 16 bit registers, 0x0103 soft reset */
+	GMSL_OV490,	/* 16 bit registers, 0xFFFD/0xFFFE select the bank */
+	GMSL_PLAIN,	/* 8 bit registers, nothing special */
+};
+
+struct gmsl_cfg {
+	const char *des_name;
+	u8 des_addr;
+	u8 des_id;
+	u8 lock_reg;		/* bit 7: enabled links locked */
+	u8 link_reg;		/* 7:4 config link, 3:0 video link detected */
+	/*
+	 * MAX9286 style link control: 0x00 3:0 enable the links, 0x0A
+	 * opens the control channel to link n with bits n and n + 4. Off,
+	 * only link 0 exists and it is always open.
+	 */
+	bool link_ctrl;
+	const char *ser_name;
+	const char *sensor_name;
+	enum gmsl_kind sensor_kind;
+	u8 sensor_addr;
+	unsigned int cameras;	/* links 0 .. cameras - 1 have a camera */
+	unsigned int lock_us;	/* SEREN to video lock */
+	/* extra chips on the local bus, 8 bit registers, 0: none */
+	u8 local_addr[2];
+};
+
+/* bus counters, snapshot for the phase accounting */
+struct gmsl_count {
+	unsigned long xfers;
+	unsigned long msgs;
+	unsigned long bytes;	/* on the wire, address bytes included */
+	unsigned long long bits;
+	s64 wait_ns;		/* sleeps, polls included */
+	unsigned long nacks;
+	unsigned long bank_writes;	/* OV490 0xFFFD/0xFFFE */
+	unsigned long bank_same;	/* ... that did not change the bank */
+};
+
+extern struct gmsl_count gmsl_count;
+
+/* command line, see sim_parse_args() */
+extern unsigned int gmsl_khz;		/* bus clock of the virtual time line */
+extern int sim_cameras;			/* -1: the simulator's default */
+extern unsigned int sim_lock_us;
+extern const char *sim_fw_dir;
+
+void gmsl_setup(const struct gmsl_cfg *cfg);
+/* a link's camera loses power and comes back with power-on defaults */
+void gmsl_power_cycle_link(unsigned int link);
+void gmsl_power_cycle(void);
+
+/*
+ * Phases: driver functions whose calls are accounted separately, nested
+ * as they call each other. Needs -finstrument-functions on the driver.
+ */
+void gmsl_phase(void *fn, const char *name);
+#define GMSL_PHASE(fn) gmsl_phase((void *)(fn), #fn)
+void gmsl_report_begin(const char *title);
+void gmsl_report_end(void);
+
+/* command line shared by the simulators, exits on errors */
+void sim_parse_args(int argc, char **argv);
+int sim_param_set(const char *name_val);
+int sim_param_get(const char *name);
+
+#endif
@@ -0,0 +1,338 @@
+/*
+ * The kernel services kernel.h declares: printing, virtual time, one
+ * work queue run inline, a flat regmap cache, firmware from a directory
+ * and the module parameter table. Not built with -finstrument-functions.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include "gmsl.h"
+
+int sim_verbose;
+s64 sim_now_ns;
+const char *sim_fw_dir;
+
+int sim_printk(const char *fmt, ...)
+{
+	va_list ap;
+	int ret;
+
+	if (!sim_verbose)
+		return 0;
+	printf("[%10.3f] ", sim_now_ns / 1e6);
+	va_start(ap, fmt);
+	ret = vprintf(fmt, ap);
+	va_end(ap);
+	if ((*fmt != '\0') && (fmt[strlen(fmt) - 1] != '\n'))
+		putchar('\n');
+
+	return ret;
+}
+
+void sim_sleep_us(u64 us)
+{
+	sim_now_ns += (s64)us * 1000;
+	gmsl_count.wait_ns += (s64)us * 1000;
+}
+
+/* work queue */
+
+#define MAX_WORK 16
+
+static struct work_struct *queue[MAX_WORK];
+static unsigned int queued;
+
+static bool dequeue(struct work_struct *work)
+{
+	unsigned int i;
+
+	for (i = 0; i < queued; i++)
+		if (queue[i] == work) {
+			memmove(&queue[i], &queue[i + 1],
+				(queued - i - 1) * sizeof(queue[0]));
+			queued--;
+			work->pending = false;
+			return true;
+		}
+
+	return false;
+}
+
+bool schedule_work(struct work_struct *work)
+{
+	if (work->pending)
+		return false;
+	if (queued == MAX_WORK) {
+		fprintf(stderr, "sim: work queue full\n");
+		exit(1);
+	}
+	work->pending = true;
+	queue[queued++] = work;
+
+	return true;
+}
+
+bool flush_work(struct work_struct *work)
+{
+	if (!dequeue(work))
+		return false;
+	work->func(work);
+
+	return true;
+}
+
+bool cancel_work_sync(struct work_struct *work)
+{
+	return dequeue(work);
+}
+
+void sim_run_work(void)
+{
+	while (queued != 0u)
+		(void)flush_work(queue[0]);
+}
+
+int wait_for_completion_interruptible(struct completion *c)
+{
+	while ((c->done == 0u) && (queued != 0u))
+		(void)flush_work(queue[0]);
+	if (c->done == 0u) {
+		fprintf(stderr, "sim: waiting for a completion nothing completes\n");
+		return -EINTR;
+	}
+
+	return 0;
+}
+
+/* regmap */
+
+struct regmap {
+	struct regmap_config config;
+	struct device *dev;
+	void *context;
+	bool dirty;
+	bool *valid;
+	unsigned int *vals;
+};
+
+struct regmap *devm_regmap_init(struct device *dev, const void *bus,
+		void *context, const struct regmap_config *config)
+{
+	struct regmap *map = calloc(1, sizeof(*map));
+	size_t n = (size_t)config->max_register + 1u;
+
+	if (map == NULL)
+		return ERR_PTR(-ENOMEM);
+	map->config = *config;
+	map->dev = dev;
+	map->context = context;
+	map->valid = calloc(n, sizeof(*map->valid));
+	map->vals = calloc(n, sizeof(*map->vals));
+	if ((map->valid == NULL) || (map->vals == NULL))
+		return ERR_PTR(-ENOMEM);
+
+	return map;
+}
+
+static bool map_cached(struct regmap *map, unsigned int reg)
+{
+	return (map->config.cache_type != REGCACHE_NONE) &&
+		((map->config.volatile_reg == NULL) ||
+		 !map->config.volatile_reg(map->dev, reg));
+}
+
+int regmap_read(struct regmap *map, unsigned int reg, unsigned int *val)
+{
+	int ret;
+
+	if (reg > map->config.max_register)
+		return -EINVAL;
+	if (map_cached(map, reg) && map->valid[reg]) {
+		*val = map->vals[reg];
+		return 0;
+	}
+	ret = map->config.reg_read(map->context, reg, val);
+	if ((ret == 0) && map_cached(map, reg)) {
+		map->vals[reg] = *val;
+		map->valid[reg] = true;
+	}
+
+	return ret;
+}
+
+int regmap_write(struct regmap *map, unsigned int reg, unsigned int val)
+{
+	int ret;
+
+	if (reg > map->config.max_register)
+		return -EINVAL;
+	ret = map->config.reg_write(map->context, reg, val);
+	if ((ret == 0) && map_cached(map, reg)) {
+		map->vals[reg] = val;
+		map->valid[reg] = true;
+	}
+
+	return ret;
+}
+
+int regcache_sync(struct regmap *map)
+{
+	unsigned int reg;
+	int ret;
+
+	if (!map->dirty)
+		return 0;
+	for (reg = 0; reg <= map->config.max_register; reg++) {
+		if (!map->valid[reg] || !map_cached(map, reg))
+			continue;
+		ret = map->config.reg_write(map->context, reg, map->vals[reg]);
+		if (ret < 0)
+			return ret;
+	}
+	map->dirty = false;
+
+	return 0;
+}
+
+void regcache_mark_dirty(struct regmap *map)
+{
+	map->dirty = true;
+}
+
+int regcache_drop_region(struct regmap *map, unsigned int min,
+		unsigned int max)
+{
+	for (; (min <= max) && (min <= map->config.max_register); min++)
+		map->valid[min] = false;
+
+	return 0;
+}
+
+/* firmware */
+
+int request_firmware_direct(const struct firmware **fw, const char *name,
+		struct device *dev)
+{
+	struct firmware *f;
+	char path[4096];
+	FILE *file;
+	long size;
+	u8 *data;
+
+	*fw = NULL;
+	if (sim_fw_dir == NULL)
+		return -ENOENT;
+	(void)snprintf(path, sizeof(path), "%s/%s", sim_fw_dir, name);
+	file = fopen(path, "rb");
+	if (file == NULL)
+		return -ENOENT;
+	(void)fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	(void)fseek(file, 0, SEEK_SET);
+	f = calloc(1, sizeof(*f));
+	data = malloc((size_t)size + 1u);
+	if ((f == NULL) || (data == NULL) ||
+	    (fread(data, 1, (size_t)size, file) != (size_t)size)) {
+		(void)fclose(file);
+		free(f);
+		free(data);
+		return -EIO;
+	}
+	(void)fclose(file);
+	f->size = (size_t)size;
+	f->data = data;
+	*fw = f;
+
+	return 0;
+}
+
+void release_firmware(const struct firmware *fw)
+{
+	if (fw == NULL)
+		return;
+	free((void *)fw->data);
+	free((void *)fw);
+}
+
+/* pinctrl and regulators */
+
+static struct pinctrl pinctrl;
+static struct pinctrl_state pinctrl_state;
+static struct regulator regulator;
+
+struct pinctrl *devm_pinctrl_get(struct device *dev)
+{
+	return &pinctrl;
+}
+
+struct pinctrl_state *pinctrl_lookup_state(struct pinctrl *p, const char *name)
+{
+	return &pinctrl_state;
+}
+
+struct regulator *devm_regulator_get(struct device *dev, const char *id)
+{
+	return &regulator;
+}
+
+/* module parameters */
+
+#define MAX_PARAMS 32
+
+static struct {
+	const char *name;
+	int *val;
+} params[MAX_PARAMS];
+static unsigned int nparams;
+
+void sim_param_add(const char *name, int *val)
+{
+	if (nparams == MAX_PARAMS) {
+		fprintf(stderr, "sim: too many module parameters\n");
+		exit(1);
+	}
+	params[nparams].name = name;
+	params[nparams].val = val;
+	nparams++;
+}
+
+static int *param_find(const char *name, size_t len)
+{
+	unsigned int i;
+
+	for (i = 0; i < nparams; i++)
+		if ((strlen(params[i].name) == len) &&
+		    (strncmp(params[i].name, name, len) == 0))
+			return params[i].val;
+
+	return NULL;
+}
+
+int sim_param_set(const char *name_val)
+{
+	const char *eq = strchr(name_val, '=');
+	int *val;
+	unsigned int i;
+
+	val = (eq != NULL) ? param_find(name_val, (size_t)(eq - name_val)) : NULL;
+	if (val == NULL) {
+		fprintf(stderr, "sim: '%s' is not name=value of a parameter:",
+			name_val);
+		for (i = 0; i < nparams; i++)
+			fprintf(stderr, " %s", params[i].name);
+		fprintf(stderr, "\n");
+		return -EINVAL;
+	}
+	*val = (int)strtol(eq + 1, NULL, 0);
+
+	return 0;
+}
+
+int sim_param_get(const char *name)
+{
+	int *val = param_find(name, strlen(name));
+
+	return (val != NULL) ? *val : 0;
+}
@@ -0,0 +1,453 @@
+/*
+ * Just enough of the kernel API to build max9286_nio_debug.c and
+ * max9288_debug.c as user-space programs, see sim/Makefile. Bus traffic
+ * goes to the chip models in gmsl.c, time is virtual: sleeps and bus
+ * transfers advance sim_now_ns instead of waiting.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#ifndef SIM_KERNEL_H
+#define SIM_KERNEL_H
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef unsigned long long u64;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef long long s64;
+typedef u8 __u8;
+typedef u16 __u16;
+typedef u32 __u32;
+typedef u64 __u64;
+typedef s16 __s16;
+typedef s32 __s32;
+typedef u32 __le32;
+typedef s64 ktime_t;
+typedef unsigned int gfp_t;
+
+#define __user
+#define __maybe_unused __attribute__((unused))
+#define ____cacheline_aligned __attribute__((aligned(64)))
+#define GFP_KERNEL 0u
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#define container_of(ptr, type, member) \
+	((type *)((char *)(ptr) - offsetof(type, member)))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min_t(t, a, b) ((t)(a) < (t)(b) ? (t)(a) : (t)(b))
+#define max_t(t, a, b) ((t)(a) > (t)(b) ? (t)(a) : (t)(b))
+#define BIT(n) (1UL << (n))
+#define le32_to_cpu(x) (x)
+#define unlikely(x) (x)
+#define likely(x) (x)
+
+#define IS_ERR(p) ((unsigned long)(p) >= (unsigned long)-4095)
+#define PTR_ERR(p) ((long)(p))
+#define ERR_PTR(e) ((void *)(long)(e))
+#define IS_ERR_OR_NULL(p) (((p) == NULL) || IS_ERR(p))
+
+/* printing: only with -v */
+extern int sim_verbose;
+int sim_printk(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+#define printk(fmt, ...) sim_printk(fmt, ##__VA_ARGS__)
+#define pr_info(fmt, ...) sim_printk(fmt, ##__VA_ARGS__)
+#define pr_err(fmt, ...) sim_printk(fmt, ##__VA_ARGS__)
+#define pr_debug(fmt, ...) sim_printk(fmt, ##__VA_ARGS__)
+#define KERN_INFO ""
+#define KERN_ERR ""
+
+/* virtual time */
+extern s64 sim_now_ns;
+void sim_sleep_us(u64 us);
+static inline ktime_t ktime_get(void) { return sim_now_ns; }
+static inline u64 ktime_get_ns(void) { return (u64)sim_now_ns; }
+static inline s64 ktime_us_delta(ktime_t a, ktime_t b) { return (a - b) / 1000; }
+static inline s64 ktime_to_us(ktime_t t) { return t / 1000; }
+static inline s64 ktime_sub(ktime_t a, ktime_t b) { return a - b; }
+#define usleep_range(lo, hi) sim_sleep_us(lo)
+#define msleep(ms) sim_sleep_us((u64)(ms) * 1000u)
+#define mdelay(ms) sim_sleep_us((u64)(ms) * 1000u)
+#define udelay(us) sim_sleep_us(us)
+static inline u64 div64_u64(u64 a, u64 b) { return a / b; }
+static inline s64 div64_s64(s64 a, s64 b) { return a / b; }
+#define do_div(n, base) ({ u32 __rem = (n) % (base); (n) /= (base); __rem; })
+
+/* memory */
+static inline void *kzalloc(size_t size, gfp_t flags) { return calloc(1, size); }
+static inline void *kmalloc(size_t size, gfp_t flags) { return malloc(size); }
+static inline void kfree(const void *p) { free((void *)p); }
+struct device;
+static inline void *devm_kzalloc(struct device *dev, size_t size, gfp_t flags)
+{
+	return calloc(1, size);
+}
+
+static inline unsigned long copy_to_user(void *to, const void *from,
+		unsigned long n)
+{
+	memcpy(to, from, n);
+	return 0;
+}
+
+static inline unsigned long copy_from_user(void *to, const void *from,
+		unsigned long n)
+{
+	memcpy(to, from, n);
+	return 0;
+}
+
+static inline void *memdup_user(const void *src, size_t len)
+{
+	void *p = malloc(len);
+
+	if (p == NULL)
+		return ERR_PTR(-ENOMEM);
+	memcpy(p, src, len);
+	return p;
+}
+
+static inline unsigned long simple_strtoul(const char *s, char **end,
+		unsigned int base)
+{
+	return strtoul(s, end, (int)base);
+}
+
+/* locking and deferred work, all on the one simulated thread */
+struct mutex { int held; };
+#define mutex_init(m) ((m)->held = 0)
+#define mutex_lock(m) ((m)->held++)
+#define mutex_unlock(m) ((m)->held--)
+
+struct work_struct {
+	void (*func)(struct work_struct *work);
+	bool pending;
+};
+#define INIT_WORK(w, f) ((w)->func = (f), (w)->pending = false)
+bool schedule_work(struct work_struct *work);
+bool flush_work(struct work_struct *work);
+bool cancel_work_sync(struct work_struct *work);
+/* not kernel API: runs what is scheduled, in order, until nothing is */
+void sim_run_work(void);
+
+struct completion { unsigned int done; };
+#define init_completion(c) ((c)->done = 0)
+#define complete_all(c) ((c)->done = ~0u)
+int wait_for_completion_interruptible(struct completion *c);
+
+/* device model */
+struct device_node { const char *name; };
+struct dev_pm_ops {
+	int (*suspend)(struct device *dev);
+	int (*resume)(struct device *dev);
+};
+#define SIMPLE_DEV_PM_OPS(name, s, r) \
+	const struct dev_pm_ops name = { .suspend = (s), .resume = (r) }
+
+struct device_driver {
+	const char *name;
+	const struct of_device_id *of_match_table;
+	int probe_type;
+	const struct dev_pm_ops *pm;
+};
+#define PROBE_PREFER_ASYNCHRONOUS 1
+
+struct device {
+	const char *init_name;
+	struct device_node *of_node;
+	void *platform_data;
+	void *driver_data;
+	const struct device_driver *driver;
+};
+static inline const char *dev_name(const struct device *dev)
+{
+	return dev->init_name;
+}
+
+struct device_attribute {
+	const char *name;
+	ssize_t (*show)(struct device *dev, struct device_attribute *attr,
+		char *buf);
+	ssize_t (*store)(struct device *dev, struct device_attribute *attr,
+		const char *buf, size_t count);
+};
+#define DEVICE_ATTR(_name, _mode, _show, _store) \
+	struct device_attribute dev_attr_##_name = { #_name, _show, _store }
+#define S_IRUGO 0444
+#define S_IWUSR 0200
+#define S_IRUSR 0400
+#define S_IWUGO 0222
+static inline int device_create_file(struct device *dev,
+		const struct device_attribute *attr)
+{
+	return 0;
+}
+struct file;
+struct kobject;
+struct bin_attribute {
+	const char *name;
+	size_t size;
+	ssize_t (*read)(struct file *filp, struct kobject *kobj,
+		struct bin_attribute *attr, char *buf, loff_t off, size_t count);
+};
+#define BIN_ATTR_RO(_name, _size) \
+	struct bin_attribute bin_attr_##_name = { #_name, _size, _name##_read }
+static inline int device_create_bin_file(struct device *dev,
+		const struct bin_attribute *attr)
+{
+	return 0;
+}
+
+struct of_device_id { char compatible[128]; const void *data; };
+struct property;
+static inline const void *of_get_property(const struct device_node *np,
+		const char *name, int *lenp)
+{
+	return NULL;
+}
+
+/* modules */
+#define THIS_MODULE NULL
+#define MODULE_PARM_DESC(name, desc)
+#define MODULE_DESCRIPTION(desc)
+#define MODULE_AUTHOR(a)
+#define MODULE_LICENSE(l)
+#define MODULE_DEVICE_TABLE(type, name)
+void sim_param_add(const char *name, int *val);
+#define module_param(name, type, perm) \
+	static void __attribute__((constructor)) sim_param_##name(void) \
+	{ sim_param_add(#name, &(name)); }
+
+/* i2c */
+#define I2C_M_RD 0x0001
+struct i2c_adapter { int nr; };
+struct i2c_msg {
+	u16 addr;
+	u16 flags;
+	u16 len;
+	u8 *buf;
+};
+struct i2c_client {
+	unsigned short addr;
+	struct i2c_adapter *adapter;
+	struct device dev;
+};
+struct i2c_device_id { char name[20]; unsigned long driver_data; };
+struct i2c_driver {
+	struct device_driver driver;
+	int (*probe)(struct i2c_client *client, const struct i2c_device_id *id);
+	int (*remove)(struct i2c_client *client);
+	const struct i2c_device_id *id_table;
+};
+extern struct i2c_driver *sim_i2c_driver;
+#define module_i2c_driver(drv) \
+	struct i2c_driver *sim_i2c_driver = &(drv)
+int i2c_transfer(struct i2c_adapter *adap, struct i2c_msg *msgs, int num);
+static inline void *i2c_get_clientdata(const struct i2c_client *client)
+{
+	return client->dev.driver_data;
+}
+static inline void i2c_set_clientdata(struct i2c_client *client, void *data)
+{
+	client->dev.driver_data = data;
+}
+#define to_i2c_client(d) container_of(d, struct i2c_client, dev)
+
+/* misc devices and file operations */
+struct inode;
+struct file { void *private_data; };
+struct file_operations {
+	void *owner;
+	long (*unlocked_ioctl)(struct file *file, unsigned int cmd,
+		unsigned long arg);
+	long (*compat_ioctl)(struct file *file, unsigned int cmd,
+		unsigned long arg);
+	int (*open)(struct inode *inode, struct file *file);
+};
+#define MISC_DYNAMIC_MINOR 255
+struct miscdevice {
+	int minor;
+	const char *name;
+	const struct file_operations *fops;
+	struct device *parent;
+	unsigned short mode;
+};
+static inline int misc_register(struct miscdevice *misc) { return 0; }
+static inline void misc_deregister(struct miscdevice *misc) { }
+
+#define _IOC(dir, type, nr, size) \
+	(((dir) << 30) | ((size) << 16) | ((type) << 8) | (nr))
+#define _IOWR(type, nr, t) _IOC(3u, (unsigned int)(type), (nr), sizeof(t))
+#define _IOC_NR(cmd) ((cmd) & 0xff)
+
+/* firmware: blobs from the directory given with -f */
+struct firmware { size_t size; const u8 *data; };
+int request_firmware_direct(const struct firmware **fw, const char *name,
+	struct device *dev);
+void release_firmware(const struct firmware *fw);
+
+/* regmap: a flat cache over reg_read / reg_write */
+enum regcache_type { REGCACHE_NONE, REGCACHE_RBTREE, REGCACHE_FLAT };
+struct regmap_config {
+	const char *name;
+	int reg_bits;
+	int val_bits;
+	unsigned int max_register;
+	bool (*volatile_reg)(struct device *dev, unsigned int reg);
+	int (*reg_read)(void *context, unsigned int reg, unsigned int *val);
+	int (*reg_write)(void *context, unsigned int reg, unsigned int val);
+	enum regcache_type cache_type;
+};
+struct regmap;
+struct regmap *devm_regmap_init(struct device *dev, const void *bus,
+	void *context, const struct regmap_config *config);
+int regmap_read(struct regmap *map, unsigned int reg, unsigned int *val);
+int regmap_write(struct regmap *map, unsigned int reg, unsigned int val);
+int regcache_sync(struct regmap *map);
+void regcache_mark_dirty(struct regmap *map);
+int regcache_drop_region(struct regmap *map, unsigned int min,
+	unsigned int max);
+
+/* pinctrl, regulators, clocks: always there, never fail */
+struct pinctrl { int x; };
+struct pinctrl_state { int x; };
+struct regulator { int x; };
+struct clk { int x; };
+struct pinctrl *devm_pinctrl_get(struct device *dev);
+struct pinctrl_state *pinctrl_lookup_state(struct pinctrl *p,
+	const char *name);
+static inline int pinctrl_select_state(struct pinctrl *p,
+		struct pinctrl_state *s)
+{
+	return 0;
+}
+struct regulator *devm_regulator_get(struct device *dev, const char *id);
+static inline int regulator_enable(struct regulator *r) { return 0; }
+static inline int regulator_disable(struct regulator *r) { return 0; }
+static inline int regulator_set_voltage(struct regulator *r, int lo, int hi)
+{
+	return 0;
+}
+
+/* V4L2 */
+enum v4l2_colorspace {
+	V4L2_COLORSPACE_DEFAULT,
+	V4L2_COLORSPACE_SMPTE170M,
+	V4L2_COLORSPACE_JPEG = 7,
+};
+enum v4l2_field { V4L2_FIELD_ANY, V4L2_FIELD_NONE };
+enum v4l2_mbus_type { V4L2_MBUS_PARALLEL, V4L2_MBUS_CSI2 = 5 };
+#define MEDIA_BUS_FMT_YUYV8_2X8 0x2008
+#define MEDIA_BUS_FMT_UYVY8_2X8 0x2006
+#define MEDIA_BUS_FMT_YVYU8_2X8 0x2009
+#define MEDIA_BUS_FMT_VYUY8_2X8 0x2007
+#define V4L2_MBUS_CSI2_4_LANE (1 << 3)
+#define V4L2_MBUS_CSI2_1_LANE (1 << 0)
+#define V4L2_MBUS_CSI2_CHANNEL_0 (1 << 4)
+#define V4L2_MBUS_CSI2_CHANNELS 0x00f0
+#define V4L2_MBUS_CSI2_CONTINUOUS_CLOCK (1 << 9)
+#define V4L2_SUBDEV_FORMAT_TRY 0
+#define V4L2_SUBDEV_FORMAT_ACTIVE 1
+#define V4L2_CHIP_MATCH_I2C_ADDR 1
+
+struct v4l2_clk { int x; };
+struct v4l2_mbus_framefmt {
+	u32 width;
+	u32 height;
+	u32 code;
+	u32 field;
+	u32 colorspace;
+};
+struct v4l2_mbus_config { enum v4l2_mbus_type type; unsigned int flags; };
+struct v4l2_subdev_pad_config { struct v4l2_mbus_framefmt try_fmt; };
+
+struct v4l2_subdev_format {
+	u32 which;
+	u32 pad;
+	struct v4l2_mbus_framefmt format;
+};
+struct v4l2_subdev_mbus_code_enum { u32 pad; u32 index; u32 code; u32 which; };
+struct v4l2_dbg_match { u32 type; u32 addr; };
+struct v4l2_dbg_register {
+	struct v4l2_dbg_match match;
+	u32 size;
+	u64 reg;
+	u64 val;
+};
+
+struct v4l2_subdev;
+struct v4l2_subdev_core_ops {
+	int (*s_power)(struct v4l2_subdev *sd, int on);
+	int (*g_register)(struct v4l2_subdev *sd, struct v4l2_dbg_register *reg);
+	int (*s_register)(struct v4l2_subdev *sd,
+		const struct v4l2_dbg_register *reg);
+};
+struct v4l2_subdev_video_ops {
+	int (*g_mbus_config)(struct v4l2_subdev *sd,
+		struct v4l2_mbus_config *cfg);
+	int (*s_stream)(struct v4l2_subdev *sd, int enable);
+	int (*s_mbus_config)(struct v4l2_subdev *sd,
+		const struct v4l2_mbus_config *cfg);
+};
+struct v4l2_subdev_pad_ops {
+	int (*enum_mbus_code)(struct v4l2_subdev *sd,
+		struct v4l2_subdev_pad_config *cfg,
+		struct v4l2_subdev_mbus_code_enum *code);
+	int (*get_fmt)(struct v4l2_subdev *sd,
+		struct v4l2_subdev_pad_config *cfg,
+		struct v4l2_subdev_format *format);
+	int (*set_fmt)(struct v4l2_subdev *sd,
+		struct v4l2_subdev_pad_config *cfg,
+		struct v4l2_subdev_format *format);
+};
+struct v4l2_subdev_ops {
+	const struct v4l2_subdev_core_ops *core;
+	const struct v4l2_subdev_video_ops *video;
+	const struct v4l2_subdev_pad_ops *pad;
+};
+struct v4l2_subdev {
+	const struct v4l2_subdev_ops *ops;
+	struct device *dev;
+	void *devdata;
+};
+static inline void v4l2_i2c_subdev_init(struct v4l2_subdev *sd,
+		struct i2c_client *client, const struct v4l2_subdev_ops *ops)
+{
+	sd->ops = ops;
+	sd->devdata = client;
+	client->dev.driver_data = sd;
+}
+static inline void *v4l2_get_subdevdata(const struct v4l2_subdev *sd)
+{
+	return sd->devdata;
+}
+static inline int v4l2_async_register_subdev(struct v4l2_subdev *sd)
+{
+	return 0;
+}
+static inline void v4l2_async_unregister_subdev(struct v4l2_subdev *sd) { }
+
+struct soc_camera_subdev_desc {
+	unsigned long flags;
+	void (*free_bus)(struct soc_camera_subdev_desc *desc);
+};
+static inline struct soc_camera_subdev_desc *soc_camera_i2c_to_desc(
+		const struct i2c_client *client)
+{
+	return client->dev.platform_data;
+}
+
+#endif
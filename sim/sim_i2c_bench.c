@@ -0,0 +1,139 @@
+/*
+ * Host time per register access through max9288_debug.c's i2c_read() and
+ * i2c_write(), against the bare i2c_transfer() of the same messages. The
+ * difference is what the helpers themselves cost. DRIVER picks the source,
+ * so an older driver can be measured the same way:
+ *
+ *   git show <commit>:max9288_debug.c > /tmp/old.c
+ *   make -C sim bench DRIVER=/tmp/old.c
+ *
+ * kzalloc() is glibc calloc() here and mutex_lock() a counter, so the
+ * numbers rank the helpers, they do not predict kernel timings.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include <time.h>
+
+#include "gmsl.h"
+#include DRIVER
+
+#define BENCH_LOOPS 10000
+#define BENCH_RUNS 500
+/* written alternately, so the shadow caches never elide the write */
+#define BENCH_WRITE_REG 0x0D
+
+static struct i2c_adapter adapter;
+static struct soc_camera_subdev_desc ssdd;
+
+static u64 host_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000ULL + (u64)ts.tv_nsec;
+}
+
+static u64 bench_transfer(struct i2c_client *client, bool rd)
+{
+	u8 buf[2] = { rd ? MAX9288_ID_REG : BENCH_WRITE_REG, 0 };
+	struct i2c_msg msg[2] = {
+		{ .addr = MAX9288_ADDR >> 1, .len = rd ? 1 : 2, .buf = buf },
+		{ .addr = MAX9288_ADDR >> 1, .flags = I2C_M_RD, .len = 1,
+		  .buf = buf + 1 },
+	};
+	u64 start = host_ns();
+	unsigned int i;
+
+	for (i = 0; i < BENCH_LOOPS; i++) {
+		buf[1] = (u8)(i & 1u);
+		(void)i2c_transfer(client->adapter, msg, rd ? 2 : 1);
+	}
+
+	return host_ns() - start;
+}
+
+static u64 bench_helper(struct i2c_client *client, bool rd)
+{
+	u8 reg = rd ? MAX9288_ID_REG : BENCH_WRITE_REG;
+	u8 val = 0;
+	u64 start = host_ns();
+	unsigned int i;
+
+	for (i = 0; i < BENCH_LOOPS; i++) {
+		if (rd) {
+			(void)i2c_read(client, MAX9288_ADDR, &reg, 1, &val);
+		} else {
+			val = (u8)(i & 1u);
+			(void)i2c_write(client, MAX9288_ADDR, &reg, 1, &val);
+		}
+	}
+
+	return host_ns() - start;
+}
+
+/* best of BENCH_RUNS, in ns per access */
+static void report(struct i2c_client *client, bool rd)
+{
+	u64 xfer = ~0ULL, helper = ~0ULL, ns;
+	unsigned int run;
+
+	for (run = 0; run < BENCH_RUNS; run++) {
+		ns = bench_transfer(client, rd);
+		if (ns < xfer)
+			xfer = ns;
+		ns = bench_helper(client, rd);
+		if (ns < helper)
+			helper = ns;
+	}
+	printf("%-10s %8.1f %8.1f %8.1f\n", rd ? "i2c_read" : "i2c_write",
+		(double)helper / BENCH_LOOPS, (double)xfer / BENCH_LOOPS,
+		((double)helper - (double)xfer) / BENCH_LOOPS);
+}
+
+int main(int argc, char **argv)
+{
+	static struct i2c_client client;
+	struct gmsl_cfg cfg = {
+		.des_name = "max9288",
+		.des_addr = MAX9288_ADDR,
+		.des_id = MAX9288_ID,
+		.lock_reg = MAX9288_LOCK_REG,
+		.link_reg = MAX9288_LINK_REG,
+		.ser_name = "max9271",
+		.sensor_name = "ov10635",
+		.sensor_kind = GMSL_SENSOR,
+		.sensor_addr = SENSOR_INIT_ADDR,
+		.cameras = 1,
+		.lock_us = sim_lock_us,
+		.local_addr = { MAX20088A_ADDR },
+	};
+	int ret;
+
+	sim_parse_args(argc, argv);
+	gmsl_setup(&cfg);
+
+	client.addr = MAX9288_ADDR >> 1;
+	client.adapter = &adapter;
+	client.dev.init_name = "2-0068";
+	client.dev.platform_data = &ssdd;
+
+	/* probe first: the helpers use the buffers and caches it sets up */
+	ret = sim_i2c_driver->probe(&client, &max9288_id[0]);
+	if (ret == 0)
+		sim_run_work();
+	if (ret < 0) {
+		printf("probe failed: %d\n", ret);
+		return 1;
+	}
+
+	printf("%s, ns per access, best of %d x %d\n", DRIVER, BENCH_RUNS,
+		BENCH_LOOPS);
+	printf("%-10s %8s %8s %8s\n", "", "helper", "transfer", "overhead");
+	report(&client, true);
+	report(&client, false);
+
+	return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * max9286_nio_debug.c against the GMSL models: MAX9286, up to four
+ * MAX96705 with an ISX016 each. Runs a cold probe and three resumes and
+ * reports the bus traffic of every init phase, see sim/Makefile.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include "gmsl.h"
+#include "../max9286_nio_debug.c"
+
+/* between suspend and resume; a power loss is at the start of it */
+#define SIM_SUSPEND_US 1000000
+#define SIM_ALL_LINKS (-1)
+#define SIM_NO_LINK (-2)
+
+static struct i2c_adapter adapter;
+static struct soc_camera_subdev_desc ssdd;
+static struct i2c_client client = {
+	.addr = MAX9286_ADDR >> 1,
+	.adapter = &adapter,
+	.dev = {
+		.init_name = "2-004a",
+		.platform_data = &ssdd,
+	},
+};
+
+static void phases(void)
+{
+	GMSL_PHASE(max9286_probe);
+	GMSL_PHASE(max9286_init_work);
+	GMSL_PHASE(max9286_resume);
+	GMSL_PHASE(max9286_cache_sync);
+	GMSL_PHASE(max9286_camera_init);
+	GMSL_PHASE(read_max9286_id);
+	GMSL_PHASE(max9286_get_link);
+	GMSL_PHASE(set_output_order);
+	GMSL_PHASE(max9286_poll_reg);
+	GMSL_PHASE(camera_module_init);
+	GMSL_PHASE(max9286_camera_has_init);
+	GMSL_PHASE(max9286_recover_links);
+	GMSL_PHASE(max9286_reset_ch_addr);
+	GMSL_PHASE(max9286_write_array);
+	GMSL_PHASE(max96705_common_init);
+	GMSL_PHASE(max9286_camera_ch_addr_init);
+}
+
+/* lost: the link whose camera loses power meanwhile, or one of SIM_* */
+static void suspend_resume(const char *title, int lost)
+{
+	const struct dev_pm_ops *pm = sim_i2c_driver->driver.pm;
+	int ret;
+
+	ret = pm->suspend(&client.dev);
+	if (lost == SIM_ALL_LINKS)
+		gmsl_power_cycle();
+	else if (lost >= 0)
+		gmsl_power_cycle_link((unsigned int)lost);
+	sim_sleep_us(SIM_SUSPEND_US);
+
+	gmsl_report_begin(title);
+	if (ret == 0)
+		ret = pm->resume(&client.dev);
+	gmsl_report_end();
+	if (ret < 0)
+		printf("  resume failed: %d\n\n", ret);
+}
+
+int main(int argc, char **argv)
+{
+	struct gmsl_cfg cfg = {
+		.des_name = "max9286",
+		.des_addr = MAX9286_ADDR,
+		.des_id = MAX9286_ID,
+		.lock_reg = MAX9286_LOCK_REG,
+		.link_reg = MAX9286_LINK_REG,
+		.link_ctrl = true,
+		.ser_name = "max96705",
+		.sensor_name = "isx016",
+		.sensor_kind = GMSL_SENSOR,
+		.sensor_addr = ISX016_INIT_ADDR,
+		.local_addr = { MAX20088_ADDR },
+	};
+	char title[80];
+	struct max9286 *priv;
+	int ret;
+
+	sim_parse_args(argc, argv);
+	cfg.cameras = (sim_cameras < 0) ? SENSOR_MAX_LINK_NUM : (unsigned int)sim_cameras;
+	cfg.lock_us = sim_lock_us;
+	gmsl_setup(&cfg);
+	phases();
+
+	(void)snprintf(title, sizeof(title), "cold probe, %u cameras",
+		cfg.cameras);
+	gmsl_report_begin(title);
+	ret = sim_i2c_driver->probe(&client, &max9286_id[0]);
+	if (ret == 0)
+		sim_run_work();
+	gmsl_report_end();
+	priv = to_max9286(&client);
+	if ((ret < 0) || (priv->init_ret < 0)) {
+		printf("  probe failed: %d/%d\n", ret, (ret < 0) ? 0 : priv->init_ret);
+		return 1;
+	}
+
+	suspend_resume("resume, every link kept its setup", SIM_NO_LINK);
+	(void)snprintf(title, sizeof(title),
+		"resume, the camera on link %u lost power", cfg.cameras - 1u);
+	suspend_resume(title, (int)cfg.cameras - 1);
+	suspend_resume("resume, the whole chain lost power", SIM_ALL_LINKS);
+
+	return 0;
+}
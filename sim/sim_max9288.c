@@ -0,0 +1,205 @@
+/*
+ * max9288_debug.c against the GMSL models. 1v1: MAX9288, MAX9271 and
+ * OV10635, probe, first s_stream(1) and two resumes. 4v4: four MAX9271
+ * with an OV490 each behind MAX9286 style link control, probe and two
+ * test pattern set_fmt calls, which write the OV490 entries of
+ * MAX9288_CAB888_4v4_init_cmd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ */
+
+#include "gmsl.h"
+#include "../max9288_debug.c"
+
+/* between suspend and resume; a power loss is at the start of it */
+#define SIM_SUSPEND_US 1000000
+
+static struct i2c_adapter adapter;
+static struct soc_camera_subdev_desc ssdd;
+
+static void client_init(struct i2c_client *client)
+{
+	memset(client, 0, sizeof(*client));
+	client->addr = MAX9288_ADDR >> 1;
+	client->adapter = &adapter;
+	client->dev.init_name = "2-0068";
+	client->dev.platform_data = &ssdd;
+}
+
+static void phases(void)
+{
+	GMSL_PHASE(max9288_probe);
+	GMSL_PHASE(max9288_init_work);
+	GMSL_PHASE(max9288_tuning_work);
+	GMSL_PHASE(max9288_s_stream);
+	GMSL_PHASE(max9288_set_fmt);
+	GMSL_PHASE(max9288_resume);
+	GMSL_PHASE(max9288_cache_sync);
+	GMSL_PHASE(max9288_links_retained);
+	GMSL_PHASE(max9288_camera_init);
+	GMSL_PHASE(read_max9288_id);
+	GMSL_PHASE(max9288_cab888_1v1_init);
+	GMSL_PHASE(max9288_cab888_4v4_init);
+	GMSL_PHASE(max9288_cab888_4v4_is_init);
+	GMSL_PHASE(max9288_camera_ch_addr_init);
+	GMSL_PHASE(max9288_seq_run);
+	GMSL_PHASE(max9288_seq_exec);
+	GMSL_PHASE(max9288_write_array);
+	GMSL_PHASE(max9288_verify_table);
+	GMSL_PHASE(max9288_poll_reg);
+	GMSL_PHASE(max9288_get_lock_status);
+}
+
+static void suspend_resume(struct i2c_client *client, const char *title,
+		bool power_loss)
+{
+	const struct dev_pm_ops *pm = sim_i2c_driver->driver.pm;
+	int ret;
+
+	ret = pm->suspend(&client->dev);
+	if (power_loss)
+		gmsl_power_cycle();
+	sim_sleep_us(SIM_SUSPEND_US);
+
+	gmsl_report_begin(title);
+	if (ret == 0)
+		ret = pm->resume(&client->dev);
+	sim_run_work();
+	gmsl_report_end();
+	if (ret < 0)
+		printf("  resume failed: %d\n\n", ret);
+}
+
+static int run_1v1(void)
+{
+	static struct i2c_client client;
+	struct gmsl_cfg cfg = {
+		.des_name = "max9288",
+		.des_addr = MAX9288_ADDR,
+		.des_id = MAX9288_ID,
+		.lock_reg = MAX9288_LOCK_REG,
+		.link_reg = MAX9288_LINK_REG,
+		.ser_name = "max9271",
+		.sensor_name = "ov10635",
+		.sensor_kind = GMSL_SENSOR,
+		.sensor_addr = SENSOR_INIT_ADDR,
+		.cameras = 1,
+		.lock_us = sim_lock_us,
+		.local_addr = { MAX20088A_ADDR },
+	};
+	struct v4l2_subdev *sd;
+	struct max9288 *priv;
+	int ret;
+
+	gmsl_setup(&cfg);
+	client_init(&client);
+
+	gmsl_report_begin("1v1 cold probe");
+	ret = sim_i2c_driver->probe(&client, &max9288_id[0]);
+	if (ret == 0)
+		sim_run_work();
+	gmsl_report_end();
+	priv = to_max9288(&client);
+	if ((ret < 0) || (priv->init_ret < 0)) {
+		printf("  probe failed: %d/%d\n", ret, (ret < 0) ? 0 : priv->init_ret);
+		return -1;
+	}
+
+	sd = &priv->subdev;
+	gmsl_report_begin("1v1 first s_stream(1)");
+	ret = sd->ops->video->s_stream(sd, 1);
+	sim_run_work();
+	gmsl_report_end();
+	if (ret < 0)
+		printf("  s_stream failed: %d\n\n", ret);
+
+	suspend_resume(&client, "1v1 resume, the link kept its setup", false);
+	suspend_resume(&client, "1v1 resume while streaming, the chain lost power",
+		true);
+
+	return 0;
+}
+
+static int run_4v4(void)
+{
+	static struct i2c_client client;
+	struct gmsl_cfg cfg = {
+		.des_name = "max9288",
+		.des_addr = MAX9288_ADDR,
+		.des_id = MAX9288_ID,
+		.lock_reg = MAX9288_LOCK_REG,
+		.link_reg = MAX9288_LINK_REG,
+		.link_ctrl = true,
+		.ser_name = "max9271",
+		.sensor_name = "ov490",
+		.sensor_kind = GMSL_OV490,
+		.sensor_addr = OV490_INIT_ADDR,
+		.lock_us = sim_lock_us,
+	};
+	struct v4l2_subdev_pad_config pad_cfg;
+	struct v4l2_subdev_format format;
+	struct v4l2_subdev *sd;
+	struct max9288 *priv;
+	char title[80];
+	int i, ret;
+
+	cfg.cameras = (sim_cameras < 0) ? 4u : (unsigned int)sim_cameras;
+	gmsl_setup(&cfg);
+	client_init(&client);
+
+	(void)snprintf(title, sizeof(title), "4v4 cold probe, %u cameras",
+		cfg.cameras);
+	gmsl_report_begin(title);
+	ret = sim_i2c_driver->probe(&client, &max9288_id[0]);
+	if (ret == 0)
+		sim_run_work();
+	gmsl_report_end();
+	priv = to_max9288(&client);
+	if ((ret < 0) || (priv->init_ret < 0)) {
+		printf("  probe failed: %d/%d\n\n", ret,
+			(ret < 0) ? 0 : priv->init_ret);
+		return -1;
+	}
+	if (priv->link != 4u) {
+		printf("  %u link set up, not 4v4\n\n", priv->link);
+		return -1;
+	}
+
+	/* the only path in the driver that writes the OV490s */
+	is_testpattern = 1;
+	sd = &priv->subdev;
+	for (i = 0; i < 2; i++) {
+		memset(&format, 0, sizeof(format));
+		format.which = V4L2_SUBDEV_FORMAT_ACTIVE;
+		format.format.code = max9288_colour_fmts[0].code;
+		format.format.width = CAB888_WIDTH;
+		format.format.height = CAB888_HEIGHT * priv->link;
+		gmsl_report_begin((i == 0) ? "4v4 set_fmt, test pattern" :
+			"4v4 set_fmt, test pattern again");
+		ret = sd->ops->pad->set_fmt(sd, &pad_cfg, &format);
+		gmsl_report_end();
+		if (ret < 0) {
+			printf("  set_fmt failed: %d\n\n", ret);
+			break;
+		}
+	}
+	is_testpattern = 0;
+
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	int ret;
+
+	sim_parse_args(argc, argv);
+	phases();
+
+	ret = run_1v1();
+	if (run_4v4() < 0)
+		ret = -1;
+
+	return (ret < 0) ? 1 : 0;
+}
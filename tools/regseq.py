@@ -0,0 +1,866 @@
+#!/usr/bin/env python3
+"""Register sequence optimizer / compiler for the max9286 and max9288 tables.
+
+Reads the struct reg_val_ops tables (and the MRSEQ u8 sequences) straight
+out of a driver source, a compiled MRSQ blob (max_reg_seq.h), or the plain
+text form below, and
+
+  report    lists dead and duplicate writes, discarded reads and burst
+            candidates, with transfers, bus time and worst case waits
+  optimize  merges consecutive registers into bursts (and on request
+            drops dead writes, duplicates and reads) and emits a C table,
+            an MRSEQ sequence, an MRSQ blob or the text form
+  diff      compares the tables of two sources, e.g. HEAD:max9288_debug.c
+            against the working tree, and prints what each change costs
+
+  regseq.py report max9286_nio_debug.c -t MAX9286_camera_pre_init_cmd
+  regseq.py optimize max9288_debug.c -t MAX9288_CAB888_4v4_init_cmd -f seq
+  regseq.py optimize max9288_debug.c -t MAX9288_CAB888_1v1_tuning_seq \
+            -f blob -o max9288_cab888_1v1_tuning.bin
+  regseq.py diff HEAD:max9288_debug.c max9288_debug.c
+
+Text form, one access per line, numbers in C syntax, '#' comments:
+
+  slave 0x60 2              following accesses: 8 bit address, reg bytes
+  w 0x301a 0xf0             write, several values make a burst
+  r 0x28                    read, the value is discarded
+  poll 0x49 0x0f 0x0f 5     reg mask val timeout_ms
+  delay 2                   ms
+
+The cost model follows the drivers: one i2c_transfer() per register with
+coalesce_writes=0, runs of consecutive registers in bursts of at most 32
+with coalesce_writes=1, a poll costs one read and at worst its timeout.
+A run of identical writes is reported as dead, but nothing is dropped
+without --drop-dead: the OV10635 tables write 0x300C and 0x3042 over and
+over as a settle delay, and the driver keeps them off its write cache for
+that reason.
+"""
+
+import argparse
+import difflib
+import os
+import re
+import struct
+import subprocess
+import sys
+
+OP_WRITE, OP_READ, OP_DELAY, OP_POLL = 'w', 'r', 'delay', 'poll'
+
+# max_reg_seq.h
+MRSEQ_END, MRSEQ_SLAVE, MRSEQ_WRITE, MRSEQ_BURST = 0, 1, 2, 3
+MRSEQ_DELAY, MRSEQ_POLL, MRSEQ_READ = 4, 5, 6
+MRSEQ_MAGIC = b'MRSQ'
+MRSEQ_VERSION = 1
+MRSEQ_BURST_MAX = 255
+
+# max9288_debug.c
+BURST_MAX = 32
+BUS_KHZ = (100, 400, 1000)
+
+
+class SeqError(Exception):
+    pass
+
+
+class Op(object):
+    """One table entry; a write with several values is a burst."""
+
+    def __init__(self, kind, slave=0, reg=0, reg_len=1, vals=None, mask=0,
+                 timeout=0, ms=0, where=''):
+        self.kind = kind
+        self.slave = slave
+        self.reg = reg
+        self.reg_len = reg_len
+        self.vals = list(vals or [])
+        self.mask = mask
+        self.timeout = timeout
+        self.ms = ms
+        self.where = where
+        self.slave_name = None
+
+    def key(self):
+        return (self.slave, self.reg_len, self.reg)
+
+    def text(self):
+        if self.kind == OP_DELAY:
+            return 'delay %d' % self.ms
+        reg = '0x%0*x' % (2 * self.reg_len, self.reg)
+        if self.kind == OP_WRITE:
+            return 'w %s %s' % (reg, ' '.join('0x%02x' % v for v in self.vals))
+        if self.kind == OP_READ:
+            return 'r %s' % reg
+        return 'poll %s 0x%02x 0x%02x %d' % (reg, self.mask, self.vals[0],
+                                             self.timeout)
+
+
+# ---------------------------------------------------------------------------
+# C sources
+
+def strip_comments(src):
+    def repl(m):
+        # keep the line count for the error messages
+        return '\n' * m.group(0).count('\n')
+    return re.sub(r'//[^\n]*|/\*.*?\*/', repl, src, flags=re.S)
+
+
+def split_top(s, sep=','):
+    """Split at sep outside of (), {} and []."""
+    parts, depth, cur = [], 0, []
+    for ch in s:
+        if ch in '({[':
+            depth += 1
+        elif ch in ')}]':
+            depth -= 1
+        if ch == sep and depth == 0:
+            parts.append(''.join(cur).strip())
+            cur = []
+        else:
+            cur.append(ch)
+    tail = ''.join(cur).strip()
+    if tail:
+        parts.append(tail)
+    return parts
+
+
+def match_brace(s, start):
+    """Index just past the bracket that closes the one at s[start]."""
+    pairs = {'{': '}', '(': ')'}
+    open_ch, close_ch = s[start], pairs[s[start]]
+    depth = 0
+    for i in range(start, len(s)):
+        if s[i] == open_ch:
+            depth += 1
+        elif s[i] == close_ch:
+            depth -= 1
+            if depth == 0:
+                return i + 1
+    raise SeqError('unbalanced %s at offset %d' % (open_ch, start))
+
+
+class CSource(object):
+    TABLE_RE = re.compile(r'static\s+(?:const\s+)?struct\s+reg_val_ops\s+'
+                          r'(\w+)\s*\[\s*\]\s*=\s*\{')
+    SEQ_RE = re.compile(r'static\s+const\s+u8\s+(\w+)\s*\[\s*\]\s*=\s*\{')
+    CAST_RE = re.compile(r'\(\s*(?:const\s+)?(?:u8|u16|u32|__u8|__u16|'
+                         r'unsigned\s+int|unsigned\s+char|int)\s*\)')
+
+    def __init__(self, path, text, defines=None):
+        self.path = path
+        src = strip_comments(text)
+        self.defines = dict(defines or {})
+        self.macros = {}
+        body = self._collect_defines(src)
+        body = self._expand_macros(body)
+        self.tables = {}
+        self.order = []
+        self._parse_tables(body)
+
+    # preprocessor, just enough for the tables
+
+    def _collect_defines(self, src):
+        out = []
+        lines = src.split('\n')
+        i = 0
+        while i < len(lines):
+            line = lines[i]
+            if not line.lstrip().startswith('#'):
+                out.append(line)
+                i += 1
+                continue
+            full = line
+            n = 1
+            while full.endswith('\\') and i + n <= len(lines) - 1:
+                full = full[:-1] + '\n' + lines[i + n]
+                n += 1
+            out.extend([''] * n)
+            i += n
+            m = re.match(r'\s*#\s*define\s+(\w+)(\(([^)]*)\))?\s*(.*)', full,
+                         re.S)
+            if not m:
+                continue
+            if m.group(2):
+                params = [p.strip() for p in m.group(3).split(',') if p.strip()]
+                self.macros[m.group(1)] = (params, m.group(4))
+            else:
+                self.defines[m.group(1)] = m.group(4).strip()
+        return '\n'.join(out)
+
+    def _expand_macros(self, body):
+        """Expand the function-like macros that build tables."""
+        names = [n for n, (_, text) in self.macros.items()
+                 if 'reg_val_ops' in text]
+        for name in names:
+            params, text = self.macros[name]
+            pos = 0
+            call_re = re.compile(r'\b%s\s*\(' % re.escape(name))
+            while True:
+                m = call_re.search(body, pos)
+                if not m:
+                    break
+                end = match_brace(body, m.end() - 1)
+                args = split_top(body[m.end():end - 1])
+                exp = text
+                for p, a in zip(params, args):
+                    exp = re.sub(r'\b%s\b' % re.escape(p), a, exp)
+                exp = re.sub(r'\s*##\s*', '', exp)
+                # one line, so the entries keep the line of the invocation
+                exp = exp.replace('\n', ' ')
+                body = body[:m.start()] + exp + body[end:]
+                pos = m.start() + len(exp)
+        return body
+
+    def value(self, expr, depth=0):
+        expr = self.CAST_RE.sub('', expr.strip())
+        if depth > 16:
+            raise SeqError('%s: recursive define in %r' % (self.path, expr))
+
+        def ident(m):
+            name = m.group(0)
+            if name not in self.defines:
+                raise SeqError('%s: unknown symbol %s' % (self.path, name))
+            return '(%d)' % self.value(self.defines[name], depth + 1)
+
+        expr = re.sub(r'\b(0[xX][0-9a-fA-F]+|\d+)[uUlL]*\b', r'\1', expr)
+        expr = re.sub(r'\b[A-Za-z_]\w*\b', ident, expr)
+        if not re.match(r'^[\s0-9a-fA-FxX()|&^~<>+*/-]*$', expr):
+            raise SeqError('%s: cannot evaluate %r' % (self.path, expr))
+        return int(eval(expr, {'__builtins__': {}}))
+
+    # tables
+
+    def _line(self, body, pos):
+        return body.count('\n', 0, pos) + 1
+
+    def _parse_tables(self, body):
+        found = []
+        for m in self.TABLE_RE.finditer(body):
+            found.append((m.start(), m.group(1), m.end() - 1, 'table'))
+        for m in self.SEQ_RE.finditer(body):
+            found.append((m.start(), m.group(1), m.end() - 1, 'seq'))
+        for _, name, brace, kind in sorted(found):
+            end = match_brace(body, brace)
+            inner = body[brace + 1:end - 1]
+            line = self._line(body, brace)
+            if kind == 'table':
+                ops = self._table_ops(name, inner, body, brace + 1)
+            else:
+                if 'MRSEQ_' not in inner:
+                    continue
+                ops = decode_seq(self._seq_bytes(inner),
+                                 '%s:%d' % (self.path, line))
+            self.tables[name] = ops
+            self.order.append(name)
+
+    def _table_ops(self, name, inner, body, base):
+        ops = []
+        pos = 0
+        while True:
+            start = inner.find('{', pos)
+            if start < 0:
+                break
+            end = match_brace(inner, start)
+            where = '%s:%d' % (self.path, self._line(body, base + start))
+            ops.append(self._entry(split_top(inner[start + 1:end - 1]), where))
+            pos = end
+        return ops
+
+    def _entry(self, f, where):
+        if len(f) < 5:
+            raise SeqError('%s: short reg_val_ops entry' % where)
+        slave = self.value(f[0])
+        reg = [self.value(r) for r in split_top(f[1].strip()[1:-1])]
+        reg += [0] * (2 - len(reg))
+        val = self.value(f[2]) & 0xFF
+        reg_len = self.value(f[3])
+        fn = f[4].strip()
+        mask = self.value(f[5]) if len(f) > 5 else 0
+        timeout = self.value(f[6]) if len(f) > 6 else 0
+        addr = (reg[0] << 8 | reg[1]) if reg_len >= 2 else reg[0]
+        if fn == 'i2c_delay':
+            op = Op(OP_DELAY, slave, ms=val, where=where)
+        elif fn == 'i2c_poll':
+            op = Op(OP_POLL, slave, addr, reg_len, [val], mask, timeout,
+                    where=where)
+        elif fn == 'i2c_read':
+            op = Op(OP_READ, slave, addr, reg_len, where=where)
+        elif fn == 'i2c_write' and reg_len == 3:
+            # reg is two bytes, the third "register" byte is val itself
+            op = Op(OP_WRITE, slave, addr, 2, [val, val], where=where)
+            op.reg_len3 = True
+        elif fn == 'i2c_write':
+            op = Op(OP_WRITE, slave, addr, reg_len, [val], where=where)
+        else:
+            raise SeqError('%s: unknown op %s' % (where, fn))
+        op.slave_name = f[0].strip() if re.match(r'^\w+$', f[0].strip()) \
+            and not re.match(r'^\d|^0[xX]', f[0].strip()) else None
+        return op
+
+    def _seq_bytes(self, inner):
+        seq_macros = {
+            'MRSEQ_SLAVE_OP': lambda s, l: [MRSEQ_SLAVE, s, l],
+            'MRSEQ_W8': lambda r, v: [MRSEQ_WRITE, r & 0xFF, v],
+            'MRSEQ_W16': lambda r, v: [MRSEQ_WRITE, r >> 8, r & 0xFF, v],
+            'MRSEQ_BURST8': lambda r, n: [MRSEQ_BURST, n, r & 0xFF],
+            'MRSEQ_BURST16': lambda r, n: [MRSEQ_BURST, n, r >> 8, r & 0xFF],
+            'MRSEQ_DELAY_OP': lambda ms: [MRSEQ_DELAY, ms],
+            'MRSEQ_POLL8': lambda r, m, v, ms: [MRSEQ_POLL, r & 0xFF, m, v, ms],
+            'MRSEQ_POLL16': lambda r, m, v, ms:
+                [MRSEQ_POLL, r >> 8, r & 0xFF, m, v, ms],
+            'MRSEQ_READ8': lambda r: [MRSEQ_READ, r & 0xFF],
+            'MRSEQ_READ16': lambda r: [MRSEQ_READ, r >> 8, r & 0xFF],
+        }
+        out = []
+        for item in split_top(inner):
+            m = re.match(r'^(\w+)\s*\((.*)\)$', item, re.S)
+            if m and m.group(1) in seq_macros:
+                args = [self.value(a) for a in split_top(m.group(2))]
+                out.extend(seq_macros[m.group(1)](*args))
+            else:
+                out.append(self.value(item))
+        return bytes(b & 0xFF for b in out)
+
+
+# ---------------------------------------------------------------------------
+# MRSQ blobs and the text form
+
+def decode_seq(data, where):
+    ops = []
+    slave, reg_len, i = 0, 1, 0
+
+    def take(n):
+        if i + n > len(data):
+            raise SeqError('%s: op at %d runs past the end' % (where, i))
+        return data[i:i + n]
+
+    def reg_at(off):
+        b = data[i + off:i + off + reg_len]
+        return (b[0] << 8 | b[1]) if reg_len == 2 else b[0]
+
+    while i < len(data):
+        op = data[i]
+        here = '%s+%d' % (where, i)
+        if op == MRSEQ_END:
+            break
+        if op == MRSEQ_SLAVE:
+            take(3)
+            slave, reg_len = data[i + 1], data[i + 2]
+            if reg_len not in (1, 2):
+                raise SeqError('%s: reg_len %d' % (here, reg_len))
+            i += 3
+        elif op == MRSEQ_WRITE:
+            take(2 + reg_len)
+            ops.append(Op(OP_WRITE, slave, reg_at(1), reg_len,
+                          [data[i + 1 + reg_len]], where=here))
+            i += 2 + reg_len
+        elif op == MRSEQ_BURST:
+            take(2)
+            n = data[i + 1]
+            take(2 + reg_len + n)
+            ops.append(Op(OP_WRITE, slave, reg_at(2), reg_len,
+                          data[i + 2 + reg_len:i + 2 + reg_len + n],
+                          where=here))
+            i += 2 + reg_len + n
+        elif op == MRSEQ_DELAY:
+            take(2)
+            ops.append(Op(OP_DELAY, ms=data[i + 1], where=here))
+            i += 2
+        elif op == MRSEQ_POLL:
+            take(4 + reg_len)
+            m, v, ms = data[i + 1 + reg_len:i + 4 + reg_len]
+            ops.append(Op(OP_POLL, slave, reg_at(1), reg_len, [v], m, ms,
+                          where=here))
+            i += 4 + reg_len
+        elif op == MRSEQ_READ:
+            take(1 + reg_len)
+            ops.append(Op(OP_READ, slave, reg_at(1), reg_len, where=here))
+            i += 1 + reg_len
+        else:
+            raise SeqError('%s: unknown op 0x%02x' % (here, op))
+    return ops
+
+
+def decode_blob(path, data):
+    if len(data) < 12 or data[:4] != MRSEQ_MAGIC:
+        raise SeqError('%s: no MRSQ header' % path)
+    version = data[4]
+    size = struct.unpack('<I', data[8:12])[0]
+    if version != MRSEQ_VERSION or size != len(data) - 12:
+        raise SeqError('%s: version %d, size %d of %d' %
+                       (path, version, size, len(data) - 12))
+    return decode_seq(data[12:], path)
+
+
+def parse_text(path, text):
+    ops = []
+    slave, reg_len = None, 1
+    for n, raw in enumerate(text.split('\n'), 1):
+        f = raw.split('#', 1)[0].split()
+        if not f:
+            continue
+        where = '%s:%d' % (path, n)
+        try:
+            nums = [int(x, 0) for x in f[1:]]
+        except ValueError:
+            raise SeqError('%s: bad number in %r' % (where, raw.strip()))
+        cmd = f[0].lower()
+        if cmd == 'slave' and len(nums) == 2 and nums[1] in (1, 2):
+            slave, reg_len = nums
+            continue
+        if cmd == 'delay' and len(nums) == 1:
+            ops.append(Op(OP_DELAY, ms=nums[0], where=where))
+            continue
+        if slave is None:
+            raise SeqError('%s: access before any slave line' % where)
+        if cmd == 'w' and len(nums) >= 2:
+            ops.append(Op(OP_WRITE, slave, nums[0], reg_len, nums[1:],
+                          where=where))
+        elif cmd == 'r' and len(nums) == 1:
+            ops.append(Op(OP_READ, slave, nums[0], reg_len, where=where))
+        elif cmd == 'poll' and len(nums) == 4:
+            ops.append(Op(OP_POLL, slave, nums[0], reg_len, [nums[2]],
+                          nums[1], nums[3], where=where))
+        else:
+            raise SeqError('%s: cannot parse %r' % (where, raw.strip()))
+    return ops
+
+
+def read_spec(spec):
+    if os.path.exists(spec):
+        with open(spec, 'rb') as f:
+            data = f.read()
+    elif ':' in spec:
+        try:
+            data = subprocess.check_output(['git', 'show', spec])
+        except (OSError, subprocess.CalledProcessError):
+            raise SeqError('%s: not a file or git object' % spec)
+    else:
+        raise SeqError('%s: no such file' % spec)
+    return data
+
+
+def load(spec, defines=None):
+    """{name: ops} and the names in source order; spec may be REV:path.
+
+    defines names a C source whose #defines the tables may use, for
+    fragments cut out of a driver.
+    """
+    data = read_spec(spec)
+    path = spec.split(':', 1)[-1] if not os.path.exists(spec) else spec
+    if data[:4] == MRSEQ_MAGIC:
+        name = os.path.splitext(os.path.basename(path))[0]
+        return {name: decode_blob(spec, data)}, [name]
+    text = data.decode('utf-8', 'replace')
+    if path.endswith(('.c', '.h')):
+        extra = CSource(defines, read_spec(defines).decode('utf-8', 'replace'))\
+            .defines if defines else None
+        src = CSource(spec, text, extra)
+        return src.tables, src.order
+    name = os.path.splitext(os.path.basename(path))[0]
+    return {name: parse_text(spec, text)}, [name]
+
+
+# ---------------------------------------------------------------------------
+# analysis
+
+def findings(ops):
+    """(index, kind, text) for every entry worth a look."""
+    out = []
+    last = {}
+    for i, op in enumerate(ops):
+        nxt = ops[i + 1] if i + 1 < len(ops) else None
+        if getattr(op, 'reg_len3', False):
+            out.append((i, 'reg_len3', 'reg_len 3 writes 0x%02x to 0x%04x '
+                        'and 0x%04x' % (op.vals[0], op.reg, op.reg + 1)))
+        if op.kind == OP_READ:
+            prev = ops[i - 1] if i else None
+            again = prev is not None and prev.kind == OP_READ and \
+                prev.key() == op.key()
+            out.append((i, 'read', 'read of 0x%02x:0x%x discarded%s' %
+                        (op.slave, op.reg, ', repeated' if again else '')))
+        if op.kind in (OP_READ, OP_POLL):
+            last.pop(op.key(), None)
+            continue
+        if op.kind != OP_WRITE:
+            continue
+        if len(op.vals) == 1 and nxt is not None and nxt.kind == OP_WRITE \
+                and nxt.key() == op.key():
+            out.append((i, 'dead', 'write 0x%02x:0x%x = 0x%02x is overwritten '
+                        'by the next entry' % (op.slave, op.reg, op.vals[0])))
+            continue
+        if len(op.vals) == 1 and last.get(op.key()) == op.vals[0]:
+            out.append((i, 'dup', 'write 0x%02x:0x%x = 0x%02x repeats an '
+                        'earlier write' % (op.slave, op.reg, op.vals[0])))
+        for n, v in enumerate(op.vals):
+            last[(op.slave, op.reg_len, op.reg + n)] = v
+    return out
+
+
+def optimize(ops, drop):
+    """Drop the findings of the kinds in drop, merge runs into bursts."""
+    gone = set(i for i, kind, _ in findings(ops) if kind in drop)
+    kept = [op for i, op in enumerate(ops) if i not in gone]
+    out = []
+    for op in kept:
+        prev = out[-1] if out else None
+        if op.kind == OP_DELAY and prev is not None and \
+                prev.kind == OP_DELAY and prev.ms + op.ms <= 255:
+            out[-1] = Op(OP_DELAY, prev.slave, ms=prev.ms + op.ms, where=prev.where)
+            out[-1].slave_name = prev.slave_name
+        elif op.kind == OP_WRITE and prev is not None and \
+                prev.kind == OP_WRITE and prev.slave == op.slave and \
+                prev.reg_len == op.reg_len and \
+                prev.reg + len(prev.vals) == op.reg and \
+                not getattr(prev, 'reg_len3', False) and \
+                not getattr(op, 'reg_len3', False):
+            merged = Op(OP_WRITE, prev.slave, prev.reg, prev.reg_len,
+                        prev.vals + op.vals, where=prev.where)
+            merged.slave_name = prev.slave_name
+            out[-1] = merged
+        else:
+            out.append(op)
+    return out
+
+
+def msg_bits(nbytes):
+    # start, address byte, data bytes with ACK, stop
+    return 2 + 9 * (1 + nbytes)
+
+
+def cost(ops, bursts):
+    """Transfers, bus bits and worst case waits for the ops."""
+    c = {'entries': len(ops), 'writes': 0, 'reads': 0, 'xfers': 0,
+         'bits': 0, 'wait_ms': 0, 'poll_ms': 0}
+    for op in ops:
+        if op.kind == OP_DELAY:
+            c['wait_ms'] += op.ms
+            continue
+        if op.kind == OP_POLL:
+            c['poll_ms'] += op.timeout
+        if op.kind in (OP_READ, OP_POLL):
+            c['reads'] += 1
+            c['xfers'] += 1
+            # repeated start instead of stop + start
+            c['bits'] += msg_bits(op.reg_len) + msg_bits(1) - 1
+            continue
+        c['writes'] += len(op.vals)
+        if getattr(op, 'reg_len3', False):
+            chunks = [op.vals]
+        elif bursts:
+            chunks = [op.vals[n:n + BURST_MAX]
+                      for n in range(0, len(op.vals), BURST_MAX)]
+        else:
+            chunks = [[v] for v in op.vals]
+        for chunk in chunks:
+            c['xfers'] += 1
+            c['bits'] += msg_bits(op.reg_len + len(chunk))
+    return c
+
+
+def driver_cost(ops):
+    """What the driver spends on ops with the default coalesce_writes=1."""
+    return cost(optimize(ops, set()), True)
+
+
+def seq_bytes(ops):
+    out = bytearray()
+    slave = None
+    for op in ops:
+        if op.kind == OP_DELAY:
+            for left in range(op.ms, 0, -255):
+                out += bytes([MRSEQ_DELAY, min(left, 255)])
+            continue
+        if (op.slave, op.reg_len) != slave:
+            slave = (op.slave, op.reg_len)
+            out += bytes([MRSEQ_SLAVE, op.slave, op.reg_len])
+        reg = bytes([op.reg >> 8, op.reg & 0xFF]) if op.reg_len == 2 \
+            else bytes([op.reg & 0xFF])
+        if op.kind == OP_READ:
+            out += bytes([MRSEQ_READ]) + reg
+        elif op.kind == OP_POLL:
+            out += bytes([MRSEQ_POLL]) + reg + \
+                bytes([op.mask, op.vals[0], min(op.timeout, 255)])
+        elif len(op.vals) == 1:
+            out += bytes([MRSEQ_WRITE]) + reg + bytes(op.vals)
+        else:
+            for n in range(0, len(op.vals), MRSEQ_BURST_MAX):
+                chunk = op.vals[n:n + MRSEQ_BURST_MAX]
+                r = op.reg + n
+                reg = bytes([r >> 8, r & 0xFF]) if op.reg_len == 2 \
+                    else bytes([r & 0xFF])
+                out += bytes([MRSEQ_BURST, len(chunk)]) + reg + bytes(chunk)
+    return bytes(out)
+
+
+# ---------------------------------------------------------------------------
+# output
+
+def fmt_text(name, ops):
+    lines = ['# %s' % name]
+    slave = None
+    for op in ops:
+        if op.kind != OP_DELAY and (op.slave, op.reg_len) != slave:
+            slave = (op.slave, op.reg_len)
+            lines.append('slave 0x%02x %d' % slave)
+        lines.append(op.text())
+    return '\n'.join(lines) + '\n'
+
+
+def fmt_table(name, ops):
+    """Bursts go out one entry per register, the driver merges them again."""
+    rows = []
+    slave = '0x00'
+    for op in ops:
+        if op.kind != OP_DELAY or op.slave:
+            slave = op.slave_name or '0x%02X' % op.slave
+        if op.kind == OP_DELAY:
+            rows.append((slave, '{0x00, 0x00},', op.ms, 1, 'i2c_delay', ''))
+            continue
+        fn = {OP_WRITE: 'i2c_write', OP_READ: 'i2c_read',
+              OP_POLL: 'i2c_poll'}[op.kind]
+        tail = ',\n\t\t0x%02X, %d' % (op.mask, op.timeout) \
+            if op.kind == OP_POLL else ''
+        if getattr(op, 'reg_len3', False):
+            vals, reg_len = op.vals[:1], 3
+        else:
+            vals, reg_len = op.vals or [0], op.reg_len
+        for n, v in enumerate(vals):
+            r = op.reg + n
+            if reg_len >= 2:
+                reg = '{0x%02X, 0x%02X},' % (r >> 8, r & 0xFF)
+            else:
+                reg = '{0x%02X, 0x00},' % r
+            rows.append((slave, reg, v, reg_len, fn, tail))
+    width = max([len(r[0]) for r in rows] + [0]) + 1
+    lines = ['static struct reg_val_ops %s[] = {' % name]
+    for slave, reg, v, reg_len, fn, tail in rows:
+        lines.append('\t{%-*s %s 0x%02X,               0x%02X, %s%s},' %
+                     (width, slave + ',', reg, v, reg_len, fn, tail))
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def fmt_seq(name, ops):
+    lines = ['static const u8 %s[] = {' % name]
+    slave = None
+    for op in ops:
+        if op.kind == OP_DELAY:
+            lines.append('\tMRSEQ_DELAY_OP(%d),' % op.ms)
+            continue
+        if (op.slave, op.reg_len) != slave:
+            slave = (op.slave, op.reg_len)
+            lines.append('\tMRSEQ_SLAVE_OP(%s, %d),' %
+                         (op.slave_name or '0x%02X' % op.slave, op.reg_len))
+        w = 8 * op.reg_len
+        reg = '0x%0*x' % (2 * op.reg_len, op.reg)
+        if op.kind == OP_READ:
+            lines.append('\tMRSEQ_READ%d(%s),' % (w, reg))
+        elif op.kind == OP_POLL:
+            lines.append('\tMRSEQ_POLL%d(%s, 0x%02x, 0x%02x, %d),' %
+                         (w, reg, op.mask, op.vals[0], op.timeout))
+        elif len(op.vals) == 1:
+            lines.append('\tMRSEQ_W%d(%s, 0x%02x),' % (w, reg, op.vals[0]))
+        else:
+            for n in range(0, len(op.vals), MRSEQ_BURST_MAX):
+                chunk = op.vals[n:n + MRSEQ_BURST_MAX]
+                lines.append('\tMRSEQ_BURST%d(0x%0*x, %d),' %
+                             (w, 2 * op.reg_len, op.reg + n, len(chunk)))
+                for k in range(0, len(chunk), 8):
+                    lines.append('\t\t' + ', '.join(
+                        '0x%02x' % v for v in chunk[k:k + 8]) + ',')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def fmt_blob(ops):
+    body = seq_bytes(ops)
+    return MRSEQ_MAGIC + bytes([MRSEQ_VERSION, 0, 0, 0]) + \
+        struct.pack('<I', len(body)) + body
+
+
+def bus_us(bits, khz):
+    return bits * 1000.0 / khz
+
+
+def cost_line(c, khz):
+    times = ', '.join('%.1f ms @%d kHz' % (bus_us(c['bits'], k) / 1000.0, k)
+                      for k in khz)
+    return '%d xfers, %d bits (%s), waits %d ms + polls up to %d ms' % (
+        c['xfers'], c['bits'], times, c['wait_ms'], c['poll_ms'])
+
+
+def report(name, ops, args, out):
+    c0 = cost(ops, False)
+    c1 = driver_cost(ops)
+    cb = cost(optimize(ops, set()), True)
+    dead = [f for f in findings(ops) if f[1] == 'dead']
+    out.write('%s: %d entries, %d writes, %d reads, %d bytes as MRSEQ\n' % (
+        name, c0['entries'], c0['writes'], c0['reads'], len(seq_bytes(ops))))
+    out.write('  coalesce 0:  %s\n' % cost_line(c0, args.khz))
+    out.write('  coalesce 1:  %s\n' % cost_line(c1, args.khz))
+    out.write('  optimized:   %s\n' % cost_line(cb, args.khz))
+    if dead:
+        cd = cost(optimize(ops, set(['dead'])), True)
+        out.write('  --drop-dead: %s\n' % cost_line(cd, args.khz))
+    for i, kind, text in findings(ops):
+        out.write('  %-8s %s  %s\n' % (kind, ops[i].where, text))
+
+
+def select(tables, order, names):
+    if not names:
+        return order
+    missing = [n for n in names if n not in tables]
+    if missing:
+        raise SeqError('no table %s' % ', '.join(missing))
+    return names
+
+
+def cmd_report(args):
+    tables, order = load(args.source, args.defines)
+    for name in select(tables, order, args.table):
+        report(name, tables[name], args, sys.stdout)
+
+
+def cmd_optimize(args):
+    tables, order = load(args.source, args.defines)
+    names = select(tables, order, args.table)
+    drop = set()
+    if args.drop_dead:
+        drop.add('dead')
+    if args.drop_dups:
+        drop.add('dup')
+    if args.drop_reads:
+        drop.add('read')
+    outs = []
+    for name in names:
+        ops = optimize(tables[name], drop)
+        before = driver_cost(tables[name])
+        after = cost(ops, True)
+        sys.stderr.write('%s: %d -> %d entries, %s\n' % (
+            name, len(tables[name]), len(ops), cost_line(after, args.khz)))
+        sys.stderr.write('%s  was %s\n' % (' ' * len(name),
+                                            cost_line(before, args.khz)))
+        if args.format == 'blob':
+            outs.append(fmt_blob(ops))
+        elif args.format == 'seq':
+            outs.append(fmt_seq(args.name or name, ops))
+        elif args.format == 'table':
+            outs.append(fmt_table(args.name or name, ops))
+        else:
+            outs.append(fmt_text(name, ops))
+    if args.format == 'blob':
+        if len(outs) != 1:
+            raise SeqError('a blob holds one table, pick it with -t')
+        if not args.output:
+            raise SeqError('a blob needs -o')
+        with open(args.output, 'wb') as f:
+            f.write(outs[0])
+        return
+    text = '\n'.join(outs)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+def cmd_diff(args):
+    old, old_order = load(args.old, args.defines)
+    new, new_order = load(args.new, args.defines)
+    names = args.table or old_order + [n for n in new_order if n not in old]
+    changed = 0
+    for name in names:
+        a, b = old.get(name), new.get(name)
+        if a is None and b is None:
+            raise SeqError('no table %s' % name)
+        ta = fmt_text(name, a).split('\n')[1:] if a is not None else []
+        tb = fmt_text(name, b).split('\n')[1:] if b is not None else []
+        if a is not None and b is not None and ta == tb:
+            continue
+        changed += 1
+        if a is None:
+            sys.stdout.write('%s: new\n' % name)
+        elif b is None:
+            sys.stdout.write('%s: removed\n' % name)
+        else:
+            sys.stdout.write('%s: changed\n' % name)
+        ca = driver_cost(a or [])
+        cb = driver_cost(b or [])
+        ca['entries'], cb['entries'] = len(a or []), len(b or [])
+        for key, label in (('entries', 'entries'), ('xfers', 'xfers'),
+                           ('wait_ms', 'waits ms'), ('poll_ms', 'polls ms')):
+            if ca[key] != cb[key]:
+                sys.stdout.write('  %-9s %6d -> %-6d (%+d)\n' % (
+                    label, ca[key], cb[key], cb[key] - ca[key]))
+        for k in args.khz:
+            ua, ub = bus_us(ca['bits'], k), bus_us(cb['bits'], k)
+            if ua != ub:
+                sys.stdout.write('  bus @%-4d %6.0f -> %-6.0f (%+.0f us)\n' % (
+                    k, ua, ub, ub - ua))
+        if args.ops:
+            for line in difflib.unified_diff(ta, tb, args.old, args.new,
+                                             lineterm='', n=1):
+                sys.stdout.write('  %s\n' % line)
+    if not changed:
+        sys.stdout.write('no table changed\n')
+
+
+def main(argv):
+    p = argparse.ArgumentParser(
+        description=__doc__.split('\n')[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog='\n'.join(__doc__.split('\n')[2:]))
+    common = argparse.ArgumentParser(add_help=False)
+    common.add_argument('--khz', default=list(BUS_KHZ),
+                        type=lambda s: [int(x) for x in s.split(',')],
+                        help='bus clocks for the timing, default 100,400,1000')
+    common.add_argument('-D', '--defines', metavar='SOURCE',
+                        help='take the #defines from this C source too')
+    sub = p.add_subparsers(dest='cmd')
+
+    r = sub.add_parser('report', parents=[common],
+                       help='costs and findings per table')
+    r.add_argument('source')
+    r.add_argument('-t', '--table', action='append')
+
+    o = sub.add_parser('optimize', parents=[common],
+                       help='emit an optimized table')
+    o.add_argument('source')
+    o.add_argument('-t', '--table', action='append')
+    o.add_argument('-f', '--format', default='text',
+                   choices=('text', 'table', 'seq', 'blob'))
+    o.add_argument('-o', '--output')
+    o.add_argument('-n', '--name', help='C name of the emitted array')
+    o.add_argument('--drop-dead', action='store_true',
+                   help='drop writes the next entry overwrites; wrong for '
+                   'runs that serve as a delay, such as OV10635 0x300C')
+    o.add_argument('--drop-dups', action='store_true',
+                   help='also drop writes of a value written before; wrong '
+                   'for self-clearing or hardware-updated registers')
+    o.add_argument('--drop-reads', action='store_true',
+                   help='also drop the reads, whose values are discarded; '
+                   'wrong where a read clears latched status')
+
+    d = sub.add_parser('diff', parents=[common],
+                       help='cost of the table changes between two sources, '
+                       'which may be git REV:path')
+    d.add_argument('old')
+    d.add_argument('new')
+    d.add_argument('-t', '--table', action='append')
+    d.add_argument('--ops', action='store_true',
+                   help='also show the changed entries')
+
+    args = p.parse_args(argv)
+    if not args.cmd:
+        p.print_help()
+        return 2
+    try:
+        {'report': cmd_report, 'optimize': cmd_optimize,
+         'diff': cmd_diff}[args.cmd](args)
+    except SeqError as e:
+        sys.stderr.write('regseq: %s\n' % e)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))